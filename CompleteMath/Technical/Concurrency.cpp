@@ -0,0 +1,80 @@
+/*
+ * Concurrency.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "Concurrency.h"
+#include "WorkStealingExecutor.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace coma {
+namespace tech {
+
+namespace{
+
+/**
+ * @brief
+ * 	Limit of threads set by user, zero means default.
+ */
+std::atomic<unsigned> threadCount { 0 };
+
+/**
+ * @brief
+ * 	Guards executors.
+ */
+std::mutex executorMutex;
+
+/**
+ * @brief
+ * 	Executor set by user.
+ */
+std::shared_ptr<Executor> externalExecutor;
+
+/**
+ * @brief
+ * 	Internal executor, started when it is needed.
+ */
+std::shared_ptr<Executor> internalExecutor;
+
+}
+
+void setThreadCount(unsigned threads){
+	threadCount.store(threads);
+	std::shared_ptr<Executor> stopped;
+	std::lock_guard<std::mutex> lock(executorMutex);
+	//old executor is stopped after the lock is released, when its last task group finishes
+	stopped.swap(internalExecutor);
+}
+
+unsigned getThreadCount() noexcept{
+	unsigned threads { threadCount.load() };
+	if(!threads) threads = std::thread::hardware_concurrency();
+	return threads ? threads : 1;
+}
+
+unsigned getParallelDepth(unsigned branches) noexcept{
+	unsigned depth { 0 };
+	for(unsigned long long tasks = 1; tasks < getThreadCount(); tasks *= branches) ++depth;
+	return depth;
+}
+
+void setExecutor(std::shared_ptr<Executor> executor){
+	std::shared_ptr<Executor> replaced { executor };
+	std::lock_guard<std::mutex> lock(executorMutex);
+	replaced.swap(externalExecutor);
+}
+
+std::shared_ptr<Executor> getExecutor(){
+	std::lock_guard<std::mutex> lock(executorMutex);
+	if(externalExecutor) return externalExecutor;
+	if(!internalExecutor) internalExecutor = std::make_shared<WorkStealingExecutor>(getThreadCount() - 1);
+	return internalExecutor;
+}
+
+} /* namespace tech */
+} /* namespace coma */
@@ -0,0 +1,81 @@
+/*
+ * Concurrency.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef TECHNICAL_CONCURRENCY_H_
+#define TECHNICAL_CONCURRENCY_H_
+
+#include "Executor.h"
+
+#include <memory>
+
+namespace coma {
+namespace tech {
+
+/**
+ * @brief
+ * 	Sets process-wide limit of threads used by parallel algorithms of the library.
+ *
+ * @details
+ * 	Limit of one makes all algorithms strictly sequential. Tasks which are already running are not affected.
+ * 	Internal executor is restarted with the new number of threads when it is needed next time.
+ *
+ * @param threads
+ * 	Maximal number of threads. Zero restores default, which is number of hardware threads.
+ */
+void setThreadCount(unsigned threads);
+
+/**
+ * @brief
+ * 	Gets process-wide limit of threads used by parallel algorithms of the library.
+ *
+ * @return
+ * 	Maximal number of threads, at least one.
+ */
+unsigned getThreadCount() noexcept;
+
+/**
+ * @brief
+ * 	Computes depth of recursion up to which subproblems are run in separate threads.
+ *
+ * @param branches
+ * 	Number of independent subproblems created at each level of recursion, at least two.
+ *
+ * @return
+ * 	The least depth d such that @a branches^d is not lesser than getThreadCount().
+ */
+unsigned getParallelDepth(unsigned branches) noexcept;
+
+/**
+ * @brief
+ * 	Sets executor of tasks forked by parallel algorithms of the library.
+ *
+ * @details
+ * 	External executor lets the library share threads of application's pool instead of starting its own ones.
+ * 	The library still forks tasks only up to getThreadCount() threads, which should match size of the pool.
+ *
+ * @param executor
+ * 	Executor of tasks. Null restores internal work-stealing executor.
+ */
+void setExecutor(std::shared_ptr<Executor> executor);
+
+/**
+ * @brief
+ * 	Gets executor of tasks forked by parallel algorithms of the library.
+ *
+ * @details
+ * 	Unless external executor is set, internal work-stealing executor is returned. It is started on the first
+ * 	call with getThreadCount() - 1 workers, as the forking thread works too.
+ *
+ * @return
+ * 	Executor of tasks.
+ */
+std::shared_ptr<Executor> getExecutor();
+
+} /* namespace tech */
+} /* namespace coma */
+
+#endif /* TECHNICAL_CONCURRENCY_H_ */
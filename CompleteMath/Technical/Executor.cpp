@@ -0,0 +1,18 @@
+/*
+ * Executor.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "Executor.h"
+
+namespace coma {
+namespace tech {
+
+bool Executor::runPendingTask(){
+	return false;
+}
+
+} /* namespace tech */
+} /* namespace coma */
@@ -0,0 +1,58 @@
+/*
+ * Executor.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef TECHNICAL_EXECUTOR_H_
+#define TECHNICAL_EXECUTOR_H_
+
+#include <functional>
+
+namespace coma {
+namespace tech {
+
+/**
+ * @brief
+ *	Interface for executor of tasks forked by parallel algorithms of the library.
+ *
+ * @details
+ * 	Implementation may run tasks in any threads and in any order, also immediately in the calling thread.
+ * 	Algorithms never wait for a task which has not started yet, they run it themselves instead, so executor
+ * 	with busy or limited threads cannot cause a deadlock.
+ */
+class Executor {
+public:
+	/**
+	 * @brief
+	 * 	Schedules task for execution.
+	 *
+	 * @param task
+	 * 	Task to run, which does not throw.
+	 */
+	virtual void execute(std::function<void()> task) = 0;
+
+	/**
+	 * @brief
+	 * 	Runs one of scheduled tasks in the calling thread, while it waits for other tasks.
+	 *
+	 * @details
+	 * 	Default implementation runs nothing, so the waiting thread is blocked.
+	 *
+	 * @return
+	 * 	True if a task was run. Else returns false.
+	 */
+	virtual bool runPendingTask();
+
+	/**
+	 * @brief
+	 * 	Default virtual destructor.
+	 */
+	virtual ~Executor() noexcept = default;
+};
+
+} /* namespace tech */
+} /* namespace coma */
+
+#endif /* TECHNICAL_EXECUTOR_H_ */
@@ -0,0 +1,101 @@
+/*
+ * TaskGroup.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "TaskGroup.h"
+#include "Concurrency.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+namespace coma {
+namespace tech {
+
+struct TaskGroup::Task {
+	std::function<void()> function;
+	std::atomic<bool> isClaimed;
+};
+
+struct TaskGroup::State {
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::size_t unfinished;
+	std::exception_ptr exception;
+};
+
+TaskGroup::TaskGroup() :
+		TaskGroup(getExecutor()){
+}
+
+TaskGroup::TaskGroup(std::shared_ptr<Executor> executor) :
+		m_executor{executor},
+		m_state{std::make_shared<State>()},
+		m_tasks{}{
+	m_state->unfinished = 0;
+}
+
+TaskGroup::~TaskGroup(){
+	try{
+		join();
+	}catch(...){
+	}
+}
+
+void TaskGroup::fork(std::function<void()> task){
+	std::shared_ptr<Task> forked = std::make_shared<Task>();
+	forked->function = std::move(task);
+	forked->isClaimed = false;
+	m_tasks.push_back(forked);
+	{
+		std::lock_guard<std::mutex> lock(m_state->mutex);
+		++m_state->unfinished;
+	}
+	std::shared_ptr<State> state = m_state;
+	m_executor->execute([forked, state](){ run(forked, *state); });
+}
+
+void TaskGroup::join(){
+	//the newest tasks are the least likely to be already claimed by other threads
+	for(auto task = m_tasks.rbegin(); task != m_tasks.rend(); ++task) run(*task, *m_state);
+	m_tasks.clear();
+	for(;;){
+		{
+			std::lock_guard<std::mutex> lock(m_state->mutex);
+			if(!m_state->unfinished) break;
+		}
+		if(!m_executor->runPendingTask()){
+			//all tasks of group are claimed and running, so waiting cannot block them
+			std::unique_lock<std::mutex> lock(m_state->mutex);
+			m_state->condition.wait(lock, [this](){ return !m_state->unfinished; });
+			break;
+		}
+	}
+	std::exception_ptr exception;
+	{
+		std::lock_guard<std::mutex> lock(m_state->mutex);
+		exception.swap(m_state->exception);
+	}
+	if(exception) std::rethrow_exception(exception);
+}
+
+void TaskGroup::run(const std::shared_ptr<Task> &task, State &state){
+	if(task->isClaimed.exchange(true)) return;
+	std::exception_ptr exception;
+	try{
+		task->function();
+	}catch(...){
+		exception = std::current_exception();
+	}
+	task->function = nullptr;
+	std::lock_guard<std::mutex> lock(state.mutex);
+	if(exception && !state.exception) state.exception = exception;
+	if(!--state.unfinished) state.condition.notify_all();
+}
+
+} /* namespace tech */
+} /* namespace coma */
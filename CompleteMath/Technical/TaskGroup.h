@@ -0,0 +1,120 @@
+/*
+ * TaskGroup.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef TECHNICAL_TASKGROUP_H_
+#define TECHNICAL_TASKGROUP_H_
+
+#include "Executor.h"
+
+#include <memory>
+#include <vector>
+
+namespace coma {
+namespace tech {
+
+/**
+ * @brief
+ *	Group of tasks forked by recursive algorithm and joined before their results are used.
+ *
+ * @details
+ * 	Forked tasks are scheduled in executor, but every task is run at most once, by the first thread which
+ * 	claims it. While joining, the group runs its unclaimed tasks itself and then helps executor with other
+ * 	tasks, so nested groups never wait for tasks which cannot start.
+ */
+class TaskGroup {
+public:
+	/**
+	 * @brief
+	 * 	Creates group using executor returned by getExecutor().
+	 */
+	TaskGroup();
+
+	/**
+	 * @brief
+	 * 	Creates group using given executor.
+	 *
+	 * @param executor
+	 * 	Executor of tasks.
+	 */
+	explicit TaskGroup(std::shared_ptr<Executor> executor);
+
+	TaskGroup(const TaskGroup &) = delete;
+
+	TaskGroup &operator=(const TaskGroup &) = delete;
+
+	/**
+	 * @brief
+	 * 	Joins remaining tasks, ignoring their exceptions.
+	 */
+	~TaskGroup();
+
+	/**
+	 * @brief
+	 * 	Schedules task in executor.
+	 *
+	 * @param task
+	 * 	Task to run.
+	 */
+	void fork(std::function<void()> task);
+
+	/**
+	 * @brief
+	 * 	Waits for all forked tasks.
+	 *
+	 * @details
+	 * 	If any task threw an exception, the first one is rethrown.
+	 */
+	void join();
+
+private:
+	/**
+	 * @brief
+	 * 	Forked task with flag telling if any thread has claimed it.
+	 */
+	struct Task;
+
+	/**
+	 * @brief
+	 * 	Counter of unfinished tasks and their exception, shared with scheduled tasks.
+	 */
+	struct State;
+
+	/**
+	 * @brief
+	 * 	Runs task unless it is already claimed.
+	 *
+	 * @param task
+	 * 	Task to run.
+	 *
+	 * @param state
+	 * 	State of group.
+	 */
+	static void run(const std::shared_ptr<Task> &task, State &state);
+
+	/**
+	 * @brief
+	 * 	Executor of tasks.
+	 */
+	std::shared_ptr<Executor> m_executor;
+
+	/**
+	 * @brief
+	 * 	State of group.
+	 */
+	std::shared_ptr<State> m_state;
+
+	/**
+	 * @brief
+	 * 	Tasks forked since the last join.
+	 */
+	std::vector<std::shared_ptr<Task>> m_tasks;
+};
+
+} /* namespace tech */
+} /* namespace coma */
+
+#endif /* TECHNICAL_TASKGROUP_H_ */
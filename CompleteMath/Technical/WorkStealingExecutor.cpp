@@ -0,0 +1,196 @@
+/*
+ * WorkStealingExecutor.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "WorkStealingExecutor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace coma {
+namespace tech {
+
+namespace{
+
+/**
+ * @brief
+ * 	Index used for threads which are not workers.
+ */
+const std::size_t NO_WORKER { static_cast<std::size_t>(-1) };
+
+/**
+ * @brief
+ * 	Deque of tasks guarded by mutex.
+ */
+struct Queue {
+	std::mutex mutex;
+	std::deque<std::function<void()>> tasks;
+};
+
+}
+
+struct WorkStealingExecutor::State {
+	/**
+	 * @brief
+	 * 	Creates empty queues.
+	 *
+	 * @param workers
+	 * 	Number of workers.
+	 */
+	explicit State(std::size_t workers) :
+			queues(workers),
+			injection{},
+			pending{0},
+			mutex{},
+			condition{},
+			isStopping{false}{
+	}
+
+	/**
+	 * @brief
+	 * 	Takes task from queues.
+	 *
+	 * @details
+	 * 	The newest task of own deque is preferred, then the oldest task of injection queue and then the oldest
+	 * 	task of other workers.
+	 *
+	 * @param task
+	 * 	Variable for task.
+	 *
+	 * @param index
+	 * 	Index of calling worker or NO_WORKER.
+	 *
+	 * @return
+	 * 	True if task was taken. Else returns false.
+	 */
+	bool take(std::function<void()> &task, std::size_t index){
+		if(!pending) return false;
+		if(index != NO_WORKER && takeFrom(queues[index], task, false)) return true;
+		if(takeFrom(injection, task, true)) return true;
+		for(std::size_t i = 1; i <= queues.size(); ++i){
+			std::size_t victim { index == NO_WORKER ? i - 1 : (index + i) % queues.size() };
+			if(victim != index && takeFrom(queues[victim], task, true)) return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief
+	 * 	Takes task from one queue.
+	 *
+	 * @param queue
+	 * 	Queue of tasks.
+	 *
+	 * @param task
+	 * 	Variable for task.
+	 *
+	 * @param isOldest
+	 * 	If true, the oldest task is taken, else the newest one.
+	 *
+	 * @return
+	 * 	True if task was taken. Else returns false.
+	 */
+	bool takeFrom(Queue &queue, std::function<void()> &task, bool isOldest){
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if(queue.tasks.empty()) return false;
+		if(isOldest){
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+		}else{
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+		}
+		--pending;
+		return true;
+	}
+
+	std::vector<Queue> queues;
+	Queue injection;
+	std::atomic<std::size_t> pending;
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool isStopping;
+};
+
+namespace{
+
+/**
+ * @brief
+ * 	State of executor, whose worker is the current thread.
+ */
+thread_local const void *currentState { nullptr };
+
+/**
+ * @brief
+ * 	Index of worker, which is the current thread.
+ */
+thread_local std::size_t currentIndex { NO_WORKER };
+
+}
+
+WorkStealingExecutor::WorkStealingExecutor(unsigned workers) :
+		m_state{std::make_shared<State>(workers)},
+		m_workers{}{
+	for(unsigned i = 0; i < workers; ++i) m_workers.emplace_back(work, m_state, i);
+}
+
+WorkStealingExecutor::~WorkStealingExecutor(){
+	{
+		std::lock_guard<std::mutex> lock(m_state->mutex);
+		m_state->isStopping = true;
+	}
+	m_state->condition.notify_all();
+	for(auto &worker : m_workers){
+		//the last owner may be task run by one of workers
+		if(worker.get_id() == std::this_thread::get_id()) worker.detach();
+		else worker.join();
+	}
+}
+
+void WorkStealingExecutor::execute(std::function<void()> task){
+	if(m_workers.empty()){
+		task();
+		return;
+	}
+	Queue &queue = currentState == m_state.get() ? m_state->queues[currentIndex] : m_state->injection;
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back(std::move(task));
+		++m_state->pending;
+	}
+	//empty critical section orders the increment before check of sleeping worker
+	{
+		std::lock_guard<std::mutex> lock(m_state->mutex);
+	}
+	m_state->condition.notify_one();
+}
+
+bool WorkStealingExecutor::runPendingTask(){
+	std::function<void()> task;
+	if(!m_state->take(task, currentState == m_state.get() ? currentIndex : NO_WORKER)) return false;
+	task();
+	return true;
+}
+
+void WorkStealingExecutor::work(std::shared_ptr<State> state, std::size_t index){
+	currentState = state.get();
+	currentIndex = index;
+	for(;;){
+		std::function<void()> task;
+		if(state->take(task, index)){
+			task();
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(state->mutex);
+		if(state->isStopping) return;
+		state->condition.wait(lock, [&](){ return state->pending || state->isStopping; });
+	}
+}
+
+} /* namespace tech */
+} /* namespace coma */
@@ -0,0 +1,86 @@
+/*
+ * WorkStealingExecutor.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef TECHNICAL_WORKSTEALINGEXECUTOR_H_
+#define TECHNICAL_WORKSTEALINGEXECUTOR_H_
+
+#include "Executor.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace coma {
+namespace tech {
+
+/**
+ * @brief
+ *	Executor with fixed number of worker threads, which steal tasks from each other.
+ *
+ * @details
+ * 	Every worker has its own deque. Tasks scheduled by a worker are pushed to its deque and the worker takes
+ * 	them back in reverse order, so recursive algorithms go depth-first and use little memory. Tasks scheduled
+ * 	by other threads go to global injection queue. Idle worker takes task from injection queue or steals the
+ * 	oldest task of other worker, which is usually the biggest subproblem.
+ */
+class WorkStealingExecutor: public Executor {
+public:
+	/**
+	 * @brief
+	 * 	Starts worker threads.
+	 *
+	 * @param workers
+	 * 	Number of worker threads. For zero every task is run immediately in the thread which schedules it.
+	 */
+	explicit WorkStealingExecutor(unsigned workers);
+
+	/**
+	 * @brief
+	 * 	Stops worker threads after they finish running tasks.
+	 */
+	virtual ~WorkStealingExecutor();
+
+	virtual void execute(std::function<void()> task) override;
+
+	virtual bool runPendingTask() override;
+
+private:
+	/**
+	 * @brief
+	 * 	Queues and synchronization shared with worker threads.
+	 */
+	struct State;
+
+	/**
+	 * @brief
+	 * 	Loop of worker thread.
+	 *
+	 * @param state
+	 * 	State of executor.
+	 *
+	 * @param index
+	 * 	Index of worker.
+	 */
+	static void work(std::shared_ptr<State> state, std::size_t index);
+
+	/**
+	 * @brief
+	 * 	State of executor, owned also by workers, as the last of them may outlive executor.
+	 */
+	std::shared_ptr<State> m_state;
+
+	/**
+	 * @brief
+	 * 	Worker threads.
+	 */
+	std::vector<std::thread> m_workers;
+};
+
+} /* namespace tech */
+} /* namespace coma */
+
+#endif /* TECHNICAL_WORKSTEALINGEXECUTOR_H_ */
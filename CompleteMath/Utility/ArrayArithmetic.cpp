@@ -1,250 +1,964 @@
-/*
- * ArrayArithmetic.cpp
- *
- *  Created on: 16 lip 2015
- *      Author: Bartosz Miera
- */
-
-#include "ArrayArithmetic.h"
-#include <algorithm>
-#include <utility>
-
-using namespace coma::tech;
-namespace coma{
-namespace util{
-
-namespace{
-/**
- * @brief
- *	Adds @c right value to @c left in place.
- *
- * @param left
- * 	Variable storing first argument and result of addition.
- *
- * @param right
- * 	Variable storing second argument.
- *
- * @param carry
- * 	Tells if carry will be added to left in this and next operation.
- */
-void addWithCarry(unsigned char &left, const unsigned char right, unsigned char &carry){
-	left += carry;
-	if(left < carry) carry = 1;
-	else carry = 0;
-
-	left += right;
-	if(left < right) carry = 1;
-}
-
-/**
- * @brief
- * 	Subtracts @c right from @c left in place. Uses and produces borrow if needed.
- *
- * @param left
- *	Number from which @c right is subtracted.
- *
- * @param right
- * 	Number which is being subtracted.
- *
- * @param borrow
- * 	Tells if borrow will be used in this and next subtraction.
- */
-void subtractWithBorrow(unsigned char &left, const unsigned char right, unsigned char &borrow){
-	if(left < borrow){
-		left -= borrow;
-		borrow = 1;
-	}
-	else{
-		left -= borrow;
-		borrow = 0;
-	}
-
-	if(left < right) borrow = 1;
-	left -= right;
-}
-
-const int compare(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	unsigned long long index { std::max(lhs.length(), rhs.length()) - 1 };
-	unsigned long long lower { std::min(lhs.length(), rhs.length()) - 1 };
-	const RuntimeArray<unsigned char> &longer { (rhs.length() > lhs.length()) ? rhs : lhs };
-	while (index > lower && longer[index] == 0){
-		--index;
-	}
-	if(index <= lower){
-		while (index > 0 && lhs[index] == rhs[index]){
-			--index;
-		}
-		if(index != 0){
-			if(lhs[index] < rhs[index]) return -1;
-			else return 1;
-		}else{
-			if(lhs[index] == rhs[index]) return 0;
-			else if(lhs[index] > rhs[index]) return 1;
-			else return -1;
-		}
-	}else{
-		return lhs.length() - rhs.length();
-	}
-}
-
-}
-
-void negate(RuntimeArray<unsigned char> &toNegate){
-	RuntimeArray<unsigned char> one(1,1);
-	for(unsigned long long i = 0; i < toNegate.length(); ++i){
-		toNegate[i] = ~toNegate[i];
-	}
-	toNegate += one;
-}
-
-const RuntimeArray<unsigned char> withoutMeaninglessChars(const RuntimeArray<unsigned char> &array, bool withSign){
-	unsigned long long result { array.length() };
-	if(withSign){
-		unsigned char mask { 0x80 };
-		unsigned char sign { mask & array[array.length() - 1] };
-		unsigned char meaninglessByte { sign ? 0xFF : 0};
-		while(result > 1 && array[result - 1] == meaninglessByte && !(sign ^ (array[result - 2] & mask))) --result;
-	}else{
-		while(!array[result - 1] && result > 1) --result;
-	}
-	return RuntimeArray<unsigned char>(array.cStyleArray(), result);
-}
-
-const RuntimeArray<unsigned char> reverse(const RuntimeArray<unsigned char> &toReverse){
-	RuntimeArray<unsigned char> copy = toReverse;
-	for(unsigned long long i = 0; i < copy.length() / 2; ++i) std::swap(copy[i], copy[copy.length() - 1 - i]);
-	return copy;
-}
-
-RuntimeArray<unsigned char> &operator+=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	unsigned char carry {0};
-	for(unsigned long long i = 0; i < rhs.length() || (carry == 1 && i < lhs.length()); ++i){
-		if(i < rhs.length()) addWithCarry(lhs[i], rhs[i], carry);
-		else addWithCarry(lhs[i], 0, carry);
-	}
-	return lhs;
-}
-
-const RuntimeArray<unsigned char> operator+(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char> result = lhs;
-	result += rhs;
-	return result;
-}
-
-RuntimeArray<unsigned char> &operator-=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	unsigned char borrow {0};
-	for(unsigned long long i = 0; i < rhs.length() || (borrow == 1 && i < lhs.length()); ++i){
-		if(i < rhs.length()) subtractWithBorrow(lhs[i], rhs[i], borrow);
-		else subtractWithBorrow(lhs[i], 0, borrow);
-	}
-	return lhs;
-}
-
-const RuntimeArray<unsigned char> operator-(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char> result = lhs;
-	result -= rhs;
-	return result;
-}
-
-const RuntimeArray<unsigned char> operator~(const RuntimeArray<unsigned char> &array){
-	RuntimeArray<unsigned char> negation{ array.length() };
-	for(unsigned long long i = 0; i < array.length(); ++i) negation[i] = ~array[i];
-	return negation;
-}
-
-const RuntimeArray<unsigned char> operator-(const RuntimeArray<unsigned char> &array){
-	RuntimeArray<unsigned char> negation{ ~array }, one{ 1, 1};
-	return negation + one;
-}
-
-RuntimeArray<unsigned char> &operator<<=(RuntimeArray<unsigned char> &lhs, unsigned long long rhs){
-	for(unsigned long long i = rhs; i < lhs.length(); ++i) lhs[lhs.length() - i] = lhs[lhs.length() - i - rhs];
-	for(unsigned long long i = 0; i < rhs; ++i) lhs[i] = 0;
-	return lhs;
-}
-
-const RuntimeArray<unsigned char> operator<<(const RuntimeArray<unsigned char> &lhs, unsigned long long rhs){
-	RuntimeArray<unsigned char> copy = lhs;
-	copy <<= rhs;
-	return copy;
-}
-
-RuntimeArray<unsigned char> &operator*=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char> table = lhs;
-	std::fill(lhs.begin(), lhs.end(), 0);
-	unsigned char carry { 0 };
-	for(unsigned long long i = 0; i < table.length(); ++i){
-		unsigned buffer { 0 };
-		for(unsigned long long j = 0; j < rhs.length() && (i + j) < lhs.length() ; ++j){
-			buffer = table[i] * rhs[j];
-			unsigned char lower { static_cast<unsigned char>(buffer)      };
-			unsigned char upper { static_cast<unsigned char>(buffer >> 8) };
-			addWithCarry(lhs[i + j    ], lower, carry);
-			if(lhs.length() > (i + j + 1)){
-				addWithCarry(lhs[i + j + 1], upper, carry);
-			}
-		}
-	}
-	return lhs;
-}
-
-const RuntimeArray<unsigned char> operator*(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char> tmp = lhs;
-	tmp *= rhs;
-	return tmp;
-}
-
-RuntimeArray<unsigned char> &operator/=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char>
-		left = lhs,
-		rema(lhs.length());
-	std::fill(lhs.begin(), lhs.end(), 0);
-	for(unsigned long long i = 0; i < lhs.length(); ++i){
-		rema <<= 1;
-		rema[0] = left[lhs.length() - 1 - i];
-		bool RgeD {};
-		do{
-			RgeD = (compare(rema, rhs) >= 0);
-			if (RgeD){
-				rema -= rhs;
-				lhs[lhs.length() - 1 - i] += 1;
-			}
-		}while(RgeD);
-	}
-	return lhs;
-}
-
-const RuntimeArray<unsigned char> operator/(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char> tmp = lhs;
-	tmp /= rhs;
-	return tmp;
-}
-
-RuntimeArray<unsigned char> &operator%=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char>
-		left = lhs,
-		quot (lhs.length());
-	std::fill(lhs.begin(), lhs.end(), 0);
-	for(unsigned long long i = 0; i < lhs.length(); ++i){
-		lhs <<= 1;
-		lhs[0] = left[quot.length() - 1 - i];
-		bool RgeD {};
-		do{
-			RgeD = (compare(lhs, rhs) >= 0);
-			if (RgeD){
-				lhs -= rhs;
-				quot[lhs.length() - 1 - i] += 1;
-			}
-		}while(RgeD);
-	}
-	return lhs;
-}
-
-const RuntimeArray<unsigned char> operator%(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
-	RuntimeArray<unsigned char> copy = lhs;
-	copy %= rhs;
-	return copy;
-}
-
-}
-}
+/*
+ * ArrayArithmetic.cpp
+ *
+ *  Created on: 16 lip 2015
+ *      Author: Bartosz Miera
+ */
+
+#include "ArrayArithmetic.h"
+#include "../Technical/Concurrency.h"
+#include "../Technical/TaskGroup.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace coma::tech;
+namespace coma{
+namespace util{
+
+namespace{
+/**
+ * @brief
+ * 	Computes reciprocal of normalized divisor.
+ *
+ * @param divisor
+ * 	Divisor with the most significant bit set.
+ *
+ * @return
+ * 	floor((2^128 - 1) / @a divisor) - 2^64.
+ */
+unsigned long long getReciprocal(unsigned long long divisor){
+	//(2^64 - 1 - divisor) * 2^64 + 2^64 - 1 divided bit by bit
+	unsigned long long remainder { ~divisor }, quotient { 0 };
+	for(int i = 0; i < 64; ++i){
+		bool carry { (remainder >> 63) != 0 };
+		remainder = (remainder << 1) | 1;
+		quotient <<= 1;
+		if(carry || remainder >= divisor){
+			remainder -= divisor;
+			quotient |= 1;
+		}
+	}
+	return quotient;
+}
+
+/**
+ * @brief
+ * 	Divides two words by normalized divisor.
+ *
+ * @param high
+ * 	More significant word of dividend, lesser than @a divisor.
+ *
+ * @param low
+ * 	Less significant word of dividend.
+ *
+ * @param divisor
+ * 	Divisor with the most significant bit set.
+ *
+ * @param reciprocal
+ * 	Reciprocal of @a divisor as returned by getReciprocal().
+ *
+ * @param remainder
+ * 	Variable for remainder of division.
+ *
+ * @return
+ * 	Quotient of division.
+ */
+unsigned long long divideWords(unsigned long long high, unsigned long long low, unsigned long long divisor,
+		unsigned long long reciprocal, unsigned long long &remainder){
+	unsigned long long quotientHigh, quotientLow;
+	multiplyWords(reciprocal, high, quotientHigh, quotientLow);
+	quotientLow += low;
+	quotientHigh += high + 1 + (quotientLow < low ? 1 : 0);
+	remainder = low - quotientHigh * divisor;
+	if(remainder > quotientLow){
+		--quotientHigh;
+		remainder += divisor;
+	}
+	if(remainder >= divisor){
+		++quotientHigh;
+		remainder -= divisor;
+	}
+	return quotientHigh;
+}
+
+/**
+ * @brief
+ * 	Reads 64 bit word from array of bytes.
+ *
+ * @param array
+ * 	Little-endian array.
+ *
+ * @param index
+ * 	Index of word.
+ *
+ * @return
+ * 	Bytes from 8 * @a index to 8 * @a index + 7 of @a array, missing ones are zeroes.
+ */
+unsigned long long getWord(const RuntimeArray<unsigned char> &array, unsigned long long index){
+	unsigned long long word { 0 };
+	for(unsigned long long i = std::min<unsigned long long>(8 * index + 8, array.length()); i-- > 8 * index;){
+		word = (word << 8) | array[i];
+	}
+	return word;
+}
+
+/**
+ * @brief
+ * 	Divides array by single word.
+ *
+ * @param dividend
+ * 	Unsigned dividend.
+ *
+ * @param divisor
+ * 	Non-zero divisor.
+ *
+ * @param quotient
+ * 	Array of the same length as @a dividend for quotient, may be the same object as @a dividend or null.
+ *
+ * @return
+ * 	Remainder of division.
+ */
+unsigned long long divideByWord(const RuntimeArray<unsigned char> &dividend, unsigned long long divisor,
+		RuntimeArray<unsigned char> *quotient){
+	unsigned shift { 0 };
+	while(!((divisor << shift) >> 63)) ++shift;
+	unsigned long long
+		normalized { divisor << shift },
+		reciprocal { getReciprocal(normalized) },
+		words { (dividend.length() + 7) / 8 },
+		remainder { shift && words ? getWord(dividend, words - 1) >> (64 - shift) : 0 };
+	for(unsigned long long i = words; i-- > 0;){
+		//dividend is shifted by the same amount as divisor, which does not change quotient
+		unsigned long long word { getWord(dividend, i) << shift };
+		if(shift && i) word |= getWord(dividend, i - 1) >> (64 - shift);
+		unsigned long long value { divideWords(remainder, word, normalized, reciprocal, remainder) };
+		if(quotient){
+			for(unsigned long long j = 8 * i; j < 8 * i + 8 && j < quotient->length(); ++j, value >>= 8){
+				(*quotient)[j] = static_cast<unsigned char>(value);
+			}
+		}
+	}
+	return remainder >> shift;
+}
+
+/**
+ * @brief
+ * 	Checks if array fits in one word.
+ *
+ * @param array
+ * 	Unsigned number.
+ *
+ * @param word
+ * 	Variable for value of @a array if it fits.
+ *
+ * @return
+ * 	True if @a array is non-zero and has at most 8 significant bytes. Else returns false.
+ */
+bool isSingleWord(const RuntimeArray<unsigned char> &array, unsigned long long &word){
+	unsigned long long length { array.length() };
+	while(length && !array[length - 1]) --length;
+	if(!length || length > 8) return false;
+	word = getWord(array, 0);
+	return true;
+}
+
+/**
+ * @brief
+ * 	Writes 64 bit word to array of bytes.
+ *
+ * @param array
+ * 	Little-endian array.
+ *
+ * @param index
+ * 	Index of word.
+ *
+ * @param word
+ * 	Value written to bytes from 8 * @a index to 8 * @a index + 7 of @a array, missing ones are skipped.
+ */
+void setWord(RuntimeArray<unsigned char> &array, unsigned long long index, unsigned long long word){
+	for(unsigned long long i = 8 * index; i < 8 * index + 8 && i < array.length(); ++i, word >>= 8){
+		array[i] = static_cast<unsigned char>(word);
+	}
+}
+
+/**
+ * @brief
+ * 	Divides array by divisor longer than one word.
+ *
+ * @details
+ * 	Schoolbook division on 64 bit words (Knuth's algorithm D). Divisor is normalized, so that every quotient
+ * 	word estimated from the two leading words of the remainder and the leading word of divisor is too big by at
+ * 	most two. The estimate is corrected with the second word of divisor before the multiple of divisor is
+ * 	subtracted, so the final add back is almost never needed.
+ *
+ * @param dividend
+ * 	Unsigned dividend, replaced by remainder.
+ *
+ * @param divisor
+ * 	Unsigned divisor with more than 8 significant bytes.
+ *
+ * @param quotient
+ * 	Array of the same length as @a dividend for quotient or null.
+ */
+void divideByWords(RuntimeArray<unsigned char> &dividend, const RuntimeArray<unsigned char> &divisor,
+		RuntimeArray<unsigned char> *quotient){
+	if(quotient) std::fill(quotient->begin(), quotient->end(), 0);
+	unsigned long long
+		length { (divisor.length() + 7) / 8 },
+		words { (dividend.length() + 7) / 8 };
+	while(length && !getWord(divisor, length - 1)) --length;
+	while(words && !getWord(dividend, words - 1)) --words;
+	if(!length || words < length) return;
+	unsigned shift { 0 };
+	while(!((getWord(divisor, length - 1) << shift) >> 63)) ++shift;
+	//both numbers are shifted by the same amount, which does not change quotient
+	std::vector<unsigned long long> lhs(words + 1), rhs(length);
+	for(unsigned long long i = 0; i < length; ++i){
+		rhs[i] = getWord(divisor, i) << shift;
+		if(shift && i) rhs[i] |= getWord(divisor, i - 1) >> (64 - shift);
+	}
+	for(unsigned long long i = 0; i <= words; ++i){
+		lhs[i] = i < words ? getWord(dividend, i) << shift : 0;
+		if(shift && i) lhs[i] |= getWord(dividend, i - 1) >> (64 - shift);
+	}
+	unsigned long long
+		leading { rhs[length - 1] },
+		second { rhs[length - 2] },
+		reciprocal { getReciprocal(leading) };
+	for(unsigned long long j = words - length + 1; j-- > 0;){
+		unsigned long long estimate, remainder;
+		if(lhs[j + length] >= leading){
+			estimate = ~0ull;
+		}else{
+			estimate = divideWords(lhs[j + length], lhs[j + length - 1], leading, reciprocal, remainder);
+			unsigned long long high, low;
+			multiplyWords(estimate, second, high, low);
+			while(high > remainder || (high == remainder && low > lhs[j + length - 2])){
+				--estimate;
+				remainder += leading;
+				if(remainder < leading) break;
+				multiplyWords(estimate, second, high, low);
+			}
+		}
+		unsigned long long carry { 0 }, borrow { 0 };
+		for(unsigned long long i = 0; i <= length; ++i){
+			unsigned long long high { 0 }, low { carry };
+			if(i < length){
+				multiplyWords(estimate, rhs[i], high, low);
+				low += carry;
+				high += low < carry ? 1 : 0;
+			}
+			carry = high;
+			unsigned long long difference { lhs[j + i] - low - borrow };
+			borrow = (lhs[j + i] < low || (lhs[j + i] == low && borrow)) ? 1 : 0;
+			lhs[j + i] = difference;
+		}
+		while(borrow){
+			//estimate was too big, divisor is added back until the remainder wraps to non-negative value
+			--estimate;
+			unsigned long long sumCarry { 0 };
+			for(unsigned long long i = 0; i <= length; ++i){
+				unsigned long long addend { i < length ? rhs[i] : 0 }, sum { lhs[j + i] + sumCarry };
+				sumCarry = sum < sumCarry ? 1 : 0;
+				sum += addend;
+				sumCarry += sum < addend ? 1 : 0;
+				lhs[j + i] = sum;
+			}
+			if(sumCarry) borrow = 0;
+		}
+		if(quotient) setWord(*quotient, j, estimate);
+	}
+	for(unsigned long long i = 0; i < (dividend.length() + 7) / 8; ++i){
+		unsigned long long word { i < length ? lhs[i] >> shift : 0 };
+		if(shift && i + 1 < length) word |= lhs[i + 1] << (64 - shift);
+		setWord(dividend, i, word);
+	}
+}
+
+/**
+ * @brief
+ * 	Minimal length in words of operands multiplied with Karatsuba method instead of schoolbook method.
+ */
+const std::size_t KARATSUBA_THRESHOLD { 32 };
+
+/**
+ * @brief
+ * 	Minimal length in words of operands, whose Karatsuba subproducts are forked as separate tasks.
+ */
+const std::size_t PARALLEL_THRESHOLD { 1 << 10 };
+
+/**
+ * @brief
+ * 	Reads unsigned number from array of bytes as 64 bit words.
+ *
+ * @param array
+ * 	Little-endian array.
+ *
+ * @return
+ * 	Words of @a array without leading zero words.
+ */
+std::vector<unsigned long long> getWords(const RuntimeArray<unsigned char> &array){
+	unsigned long long length { (array.length() + 7) / 8 };
+	while(length && !getWord(array, length - 1)) --length;
+	std::vector<unsigned long long> words(length);
+	for(unsigned long long i = 0; i < length; ++i) words[i] = getWord(array, i);
+	return words;
+}
+
+/**
+ * @brief
+ * 	Writes words to array of bytes.
+ *
+ * @param array
+ * 	Little-endian array, words which do not fit are skipped and missing ones are zeroes.
+ *
+ * @param words
+ * 	Words of number.
+ */
+void setWords(RuntimeArray<unsigned char> &array, const std::vector<unsigned long long> &words){
+	for(unsigned long long i = 0; i < (array.length() + 7) / 8; ++i) setWord(array, i, i < words.size() ? words[i] : 0);
+}
+
+/**
+ * @brief
+ * 	Adds carry to words in place.
+ *
+ * @param array
+ * 	Words of number.
+ *
+ * @param length
+ * 	Number of words.
+ *
+ * @param carry
+ * 	Value added to the least significant word.
+ */
+void addCarry(unsigned long long *array, std::size_t length, unsigned long long carry){
+	for(std::size_t i = 0; carry && i < length; ++i){
+		array[i] += carry;
+		carry = array[i] < carry ? 1 : 0;
+	}
+}
+
+/**
+ * @brief
+ * 	Computes absolute difference of two numbers.
+ *
+ * @param lhs
+ * 	Words of first number.
+ *
+ * @param lhsLength
+ * 	Number of words of @a lhs, not greater than @a length.
+ *
+ * @param rhs
+ * 	Words of second number.
+ *
+ * @param length
+ * 	Number of words of @a rhs.
+ *
+ * @param result
+ * 	Buffer of @a length words for |@a lhs - @a rhs|.
+ *
+ * @return
+ * 	True if @a lhs is lesser than @a rhs. Else returns false.
+ */
+bool getDifference(const unsigned long long *lhs, std::size_t lhsLength, const unsigned long long *rhs,
+		std::size_t length, unsigned long long *result){
+	std::fill(result, result + length, 0);
+	std::copy(lhs, lhs + lhsLength, result);
+	bool isLesser { false };
+	for(std::size_t i = length; i-- > 0;){
+		if(result[i] != rhs[i]){
+			isLesser = result[i] < rhs[i];
+			break;
+		}
+	}
+	if(!isLesser){
+		subtractWords(result, rhs, length);
+		return false;
+	}
+	std::vector<unsigned long long> minuend(rhs, rhs + length);
+	subtractWords(minuend.data(), result, length);
+	std::copy(minuend.begin(), minuend.end(), result);
+	return true;
+}
+
+/**
+ * @brief
+ * 	Multiplies numbers with schoolbook method.
+ *
+ * @param lhs
+ * 	Words of first factor.
+ *
+ * @param lhsLength
+ * 	Number of words of @a lhs.
+ *
+ * @param rhs
+ * 	Words of second factor.
+ *
+ * @param rhsLength
+ * 	Number of words of @a rhs.
+ *
+ * @param result
+ * 	Buffer of @a lhsLength + @a rhsLength words for product.
+ */
+void multiplyBasecase(const unsigned long long *lhs, std::size_t lhsLength, const unsigned long long *rhs,
+		std::size_t rhsLength, unsigned long long *result){
+	std::fill(result, result + lhsLength + rhsLength, 0);
+	for(std::size_t i = 0; i < lhsLength; ++i){
+		if(!lhs[i]) continue;
+		unsigned long long carry { 0 };
+		for(std::size_t j = 0; j < rhsLength; ++j){
+			unsigned long long high, low, current { result[i + j] };
+			multiplyWords(lhs[i], rhs[j], high, low);
+			low += carry;
+			high += low < carry ? 1 : 0;
+			low += current;
+			high += low < current ? 1 : 0;
+			result[i + j] = low;
+			carry = high;
+		}
+		result[i + rhsLength] = carry;
+	}
+}
+
+/**
+ * @brief
+ * 	Squares number with schoolbook method.
+ *
+ * @details
+ * 	Every cross product is computed once and doubled.
+ *
+ * @param array
+ * 	Words of number.
+ *
+ * @param length
+ * 	Number of words of @a array.
+ *
+ * @param result
+ * 	Buffer of 2 * @a length words for square.
+ */
+void squareBasecase(const unsigned long long *array, std::size_t length, unsigned long long *result){
+	std::fill(result, result + 2 * length, 0);
+	for(std::size_t i = 0; i < length; ++i){
+		if(!array[i]) continue;
+		unsigned long long carry { 0 };
+		for(std::size_t j = i + 1; j < length; ++j){
+			unsigned long long high, low, current { result[i + j] };
+			multiplyWords(array[i], array[j], high, low);
+			low += carry;
+			high += low < carry ? 1 : 0;
+			low += current;
+			high += low < current ? 1 : 0;
+			result[i + j] = low;
+			carry = high;
+		}
+		result[i + length] = carry;
+	}
+	unsigned long long top { 0 };
+	for(std::size_t i = 0; i < 2 * length; ++i){
+		unsigned long long word { result[i] };
+		result[i] = (word << 1) | top;
+		top = word >> 63;
+	}
+	unsigned long long carry { 0 };
+	for(std::size_t i = 0; i < length; ++i){
+		unsigned long long high, low;
+		multiplyWords(array[i], array[i], high, low);
+		unsigned long long diagonal[2] = { low, high };
+		for(std::size_t j = 0; j < 2; ++j){
+			unsigned long long sum { result[2 * i + j] + carry };
+			carry = sum < carry ? 1 : 0;
+			sum += diagonal[j];
+			carry += sum < diagonal[j] ? 1 : 0;
+			result[2 * i + j] = sum;
+		}
+	}
+}
+
+/**
+ * @brief
+ * 	Adds middle term of Karatsuba product to the sum of its outer terms.
+ *
+ * @details
+ * 	Middle term equals z0 + z2 - d, where z0 and z2 are products of lower and higher halves, which are already
+ * 	stored in @a result, and d is product of differences of halves.
+ *
+ * @param result
+ * 	Buffer of 2 * @a length words containing z0 on 2 * @a low words and z2 above them.
+ *
+ * @param length
+ * 	Number of words of factors.
+ *
+ * @param low
+ * 	Number of words of lower halves.
+ *
+ * @param difference
+ * 	Absolute value of d on 2 * (@a length - @a low) words.
+ *
+ * @param isNegative
+ * 	Tells if d is negative.
+ */
+void addMiddleTerm(unsigned long long *result, std::size_t length, std::size_t low,
+		const std::vector<unsigned long long> &difference, bool isNegative){
+	std::size_t high { length - low };
+	std::vector<unsigned long long> middle(2 * high + 1, 0);
+	std::copy(result, result + 2 * low, middle.begin());
+	middle[2 * high] = addWords(middle.data(), result + 2 * low, 2 * high);
+	//middle term is non-negative, so borrow never leaves the last word
+	if(isNegative) middle[2 * high] += addWords(middle.data(), difference.data(), 2 * high);
+	else middle[2 * high] -= subtractWords(middle.data(), difference.data(), 2 * high);
+	unsigned long long carry { addWords(result + low, middle.data(), middle.size()) };
+	addCarry(result + low + middle.size(), 2 * length - low - middle.size(), carry);
+}
+
+/**
+ * @brief
+ * 	Multiplies numbers of the same length with Karatsuba method.
+ *
+ * @details
+ * 	Subtractive variant is used: a0 * b1 + a1 * b0 = a0 * b0 + a1 * b1 - (a0 - a1) * (b0 - b1), so all three
+ * 	subproducts have operands not longer than halves. Subproducts are independent, so for long operands they
+ * 	are forked as tasks of executor.
+ *
+ * @param lhs
+ * 	Words of first factor.
+ *
+ * @param rhs
+ * 	Words of second factor.
+ *
+ * @param length
+ * 	Number of words of both factors.
+ *
+ * @param result
+ * 	Buffer of 2 * @a length words for product.
+ *
+ * @param depth
+ * 	Number of levels of recursion, which may still fork tasks.
+ */
+void multiplyKaratsuba(const unsigned long long *lhs, const unsigned long long *rhs, std::size_t length,
+		unsigned long long *result, unsigned depth){
+	if(length < KARATSUBA_THRESHOLD){
+		multiplyBasecase(lhs, length, rhs, length, result);
+		return;
+	}
+	std::size_t low { length / 2 }, high { length - low };
+	std::vector<unsigned long long> lhsDifference(high), rhsDifference(high), difference(2 * high);
+	bool isNegative { getDifference(lhs, low, lhs + low, high, lhsDifference.data()) !=
+			getDifference(rhs, low, rhs + low, high, rhsDifference.data()) };
+	if(depth && length >= PARALLEL_THRESHOLD){
+		TaskGroup group;
+		group.fork([=](){ multiplyKaratsuba(lhs, rhs, low, result, depth - 1); });
+		group.fork([=](){ multiplyKaratsuba(lhs + low, rhs + low, high, result + 2 * low, depth - 1); });
+		multiplyKaratsuba(lhsDifference.data(), rhsDifference.data(), high, difference.data(), depth - 1);
+		group.join();
+	}else{
+		multiplyKaratsuba(lhs, rhs, low, result, 0);
+		multiplyKaratsuba(lhs + low, rhs + low, high, result + 2 * low, 0);
+		multiplyKaratsuba(lhsDifference.data(), rhsDifference.data(), high, difference.data(), 0);
+	}
+	addMiddleTerm(result, length, low, difference, isNegative);
+}
+
+/**
+ * @brief
+ * 	Squares number with Karatsuba method.
+ *
+ * @details
+ * 	Middle term 2 * a0 * a1 = a0^2 + a1^2 - (a0 - a1)^2, so all three subproducts are squares.
+ *
+ * @param array
+ * 	Words of number.
+ *
+ * @param length
+ * 	Number of words of @a array.
+ *
+ * @param result
+ * 	Buffer of 2 * @a length words for square.
+ *
+ * @param depth
+ * 	Number of levels of recursion, which may still fork tasks.
+ */
+void squareKaratsuba(const unsigned long long *array, std::size_t length, unsigned long long *result, unsigned depth){
+	if(length < KARATSUBA_THRESHOLD){
+		squareBasecase(array, length, result);
+		return;
+	}
+	std::size_t low { length / 2 }, high { length - low };
+	std::vector<unsigned long long> arrayDifference(high), difference(2 * high);
+	getDifference(array, low, array + low, high, arrayDifference.data());
+	if(depth && length >= PARALLEL_THRESHOLD){
+		TaskGroup group;
+		group.fork([=](){ squareKaratsuba(array, low, result, depth - 1); });
+		group.fork([=](){ squareKaratsuba(array + low, high, result + 2 * low, depth - 1); });
+		squareKaratsuba(arrayDifference.data(), high, difference.data(), depth - 1);
+		group.join();
+	}else{
+		squareKaratsuba(array, low, result, 0);
+		squareKaratsuba(array + low, high, result + 2 * low, 0);
+		squareKaratsuba(arrayDifference.data(), high, difference.data(), 0);
+	}
+	addMiddleTerm(result, length, low, difference, false);
+}
+
+/**
+ * @brief
+ * 	Multiplies numbers of any lengths.
+ *
+ * @details
+ * 	Longer factor is split into chunks of the length of the shorter one, which are multiplied with Karatsuba
+ * 	method and added at their offsets.
+ *
+ * @param lhs
+ * 	Words of first factor.
+ *
+ * @param lhsLength
+ * 	Number of words of @a lhs.
+ *
+ * @param rhs
+ * 	Words of second factor.
+ *
+ * @param rhsLength
+ * 	Number of words of @a rhs.
+ *
+ * @param result
+ * 	Buffer of @a lhsLength + @a rhsLength words for product.
+ *
+ * @param depth
+ * 	Number of levels of recursion, which may still fork tasks.
+ */
+void multiplyUnbalanced(const unsigned long long *lhs, std::size_t lhsLength, const unsigned long long *rhs,
+		std::size_t rhsLength, unsigned long long *result, unsigned depth){
+	if(lhsLength < rhsLength){
+		std::swap(lhs, rhs);
+		std::swap(lhsLength, rhsLength);
+	}
+	if(rhsLength < KARATSUBA_THRESHOLD){
+		multiplyBasecase(lhs, lhsLength, rhs, rhsLength, result);
+		return;
+	}
+	if(lhsLength == rhsLength){
+		multiplyKaratsuba(lhs, rhs, rhsLength, result, depth);
+		return;
+	}
+	std::fill(result, result + lhsLength + rhsLength, 0);
+	std::vector<unsigned long long> chunk(2 * rhsLength);
+	for(std::size_t offset = 0; offset < lhsLength; offset += rhsLength){
+		std::size_t length { std::min(rhsLength, lhsLength - offset) };
+		multiplyUnbalanced(lhs + offset, length, rhs, rhsLength, chunk.data(), depth);
+		unsigned long long carry { addWords(result + offset, chunk.data(), length + rhsLength) };
+		addCarry(result + offset + length + rhsLength, lhsLength - offset - length, carry);
+	}
+}
+
+/**
+ * @brief
+ * 	Computes number of levels of Karatsuba recursion, which may fork tasks.
+ *
+ * @param length
+ * 	Number of words of the longer factor.
+ *
+ * @return
+ * 	Zero for operands shorter than parallel threshold, else depth at which all allowed threads are busy.
+ */
+unsigned getMultiplicationDepth(std::size_t length){
+	return length < PARALLEL_THRESHOLD ? 0 : getParallelDepth(3);
+}
+
+/**
+ * @brief
+ *	Adds @c right value to @c left in place.
+ *
+ * @param left
+ * 	Variable storing first argument and result of addition.
+ *
+ * @param right
+ * 	Variable storing second argument.
+ *
+ * @param carry
+ * 	Tells if carry will be added to left in this and next operation.
+ */
+void addWithCarry(unsigned char &left, const unsigned char right, unsigned char &carry){
+	left += carry;
+	if(left < carry) carry = 1;
+	else carry = 0;
+
+	left += right;
+	if(left < right) carry = 1;
+}
+
+/**
+ * @brief
+ * 	Subtracts @c right from @c left in place. Uses and produces borrow if needed.
+ *
+ * @param left
+ *	Number from which @c right is subtracted.
+ *
+ * @param right
+ * 	Number which is being subtracted.
+ *
+ * @param borrow
+ * 	Tells if borrow will be used in this and next subtraction.
+ */
+void subtractWithBorrow(unsigned char &left, const unsigned char right, unsigned char &borrow){
+	if(left < borrow){
+		left -= borrow;
+		borrow = 1;
+	}
+	else{
+		left -= borrow;
+		borrow = 0;
+	}
+
+	if(left < right) borrow = 1;
+	left -= right;
+}
+
+}
+
+const int compare(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	unsigned long long index { std::max(lhs.length(), rhs.length()) - 1 };
+	unsigned long long lower { std::min(lhs.length(), rhs.length()) - 1 };
+	const RuntimeArray<unsigned char> &longer { (rhs.length() > lhs.length()) ? rhs : lhs };
+	while (index > lower && longer[index] == 0){
+		--index;
+	}
+	if(index <= lower){
+		while (index > 0 && lhs[index] == rhs[index]){
+			--index;
+		}
+		if(index != 0){
+			if(lhs[index] < rhs[index]) return -1;
+			else return 1;
+		}else{
+			if(lhs[index] == rhs[index]) return 0;
+			else if(lhs[index] > rhs[index]) return 1;
+			else return -1;
+		}
+	}else{
+		return (lhs.length() > rhs.length()) ? 1 : -1;
+	}
+}
+
+void negate(RuntimeArray<unsigned char> &toNegate){
+	RuntimeArray<unsigned char> one(1,1);
+	for(unsigned long long i = 0; i < toNegate.length(); ++i){
+		toNegate[i] = ~toNegate[i];
+	}
+	toNegate += one;
+}
+
+const RuntimeArray<unsigned char> withoutMeaninglessChars(const RuntimeArray<unsigned char> &array, bool withSign){
+	unsigned long long result { array.length() };
+	if(withSign){
+		unsigned char mask { 0x80 };
+		unsigned char sign { mask & array[array.length() - 1] };
+		unsigned char meaninglessByte { sign ? 0xFF : 0};
+		while(result > 1 && array[result - 1] == meaninglessByte && !(sign ^ (array[result - 2] & mask))) --result;
+	}else{
+		while(!array[result - 1] && result > 1) --result;
+	}
+	return RuntimeArray<unsigned char>(array.cStyleArray(), result);
+}
+
+const RuntimeArray<unsigned char> reverse(const RuntimeArray<unsigned char> &toReverse){
+	RuntimeArray<unsigned char> copy = toReverse;
+	for(unsigned long long i = 0; i < copy.length() / 2; ++i) std::swap(copy[i], copy[copy.length() - 1 - i]);
+	return copy;
+}
+
+RuntimeArray<unsigned char> &operator+=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	unsigned char carry {0};
+	for(unsigned long long i = 0; i < rhs.length() || (carry == 1 && i < lhs.length()); ++i){
+		if(i < rhs.length()) addWithCarry(lhs[i], rhs[i], carry);
+		else addWithCarry(lhs[i], 0, carry);
+	}
+	return lhs;
+}
+
+const RuntimeArray<unsigned char> operator+(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	RuntimeArray<unsigned char> result = lhs;
+	result += rhs;
+	return result;
+}
+
+RuntimeArray<unsigned char> &operator-=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	unsigned char borrow {0};
+	for(unsigned long long i = 0; i < rhs.length() || (borrow == 1 && i < lhs.length()); ++i){
+		if(i < rhs.length()) subtractWithBorrow(lhs[i], rhs[i], borrow);
+		else subtractWithBorrow(lhs[i], 0, borrow);
+	}
+	return lhs;
+}
+
+const RuntimeArray<unsigned char> operator-(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	RuntimeArray<unsigned char> result = lhs;
+	result -= rhs;
+	return result;
+}
+
+const RuntimeArray<unsigned char> operator~(const RuntimeArray<unsigned char> &array){
+	RuntimeArray<unsigned char> negation{ array.length() };
+	for(unsigned long long i = 0; i < array.length(); ++i) negation[i] = ~array[i];
+	return negation;
+}
+
+const RuntimeArray<unsigned char> operator-(const RuntimeArray<unsigned char> &array){
+	RuntimeArray<unsigned char> negation{ ~array }, one{ 1, 1};
+	return negation + one;
+}
+
+RuntimeArray<unsigned char> &operator<<=(RuntimeArray<unsigned char> &lhs, unsigned long long rhs){
+	for(unsigned long long i = rhs; i < lhs.length(); ++i) lhs[lhs.length() - i] = lhs[lhs.length() - i - rhs];
+	for(unsigned long long i = 0; i < rhs; ++i) lhs[i] = 0;
+	return lhs;
+}
+
+const RuntimeArray<unsigned char> operator<<(const RuntimeArray<unsigned char> &lhs, unsigned long long rhs){
+	RuntimeArray<unsigned char> copy = lhs;
+	copy <<= rhs;
+	return copy;
+}
+
+RuntimeArray<unsigned char> &shiftBitsLeft(RuntimeArray<unsigned char> &array, unsigned long long bits){
+	unsigned long long bytes { bits / 8 };
+	unsigned char offset = bits % 8;
+	for(unsigned long long i = array.length(); i-- > 0;){
+		unsigned char value { 0 };
+		if(i >= bytes){
+			value = array[i - bytes] << offset;
+			if(offset && i > bytes) value |= array[i - bytes - 1] >> (8 - offset);
+		}
+		array[i] = value;
+	}
+	return array;
+}
+
+RuntimeArray<unsigned char> &shiftBitsRight(RuntimeArray<unsigned char> &array, unsigned long long bits, bool withSign){
+	unsigned long long bytes { bits / 8 };
+	unsigned char offset = bits % 8;
+	unsigned char fill = (withSign && array.length() && (array[array.length() - 1] & 0x80)) ? 0xFF : 0;
+	for(unsigned long long i = 0; i < array.length(); ++i){
+		unsigned char lower = (i + bytes < array.length()) ? array[i + bytes] : fill;
+		unsigned char upper = (i + bytes + 1 < array.length()) ? array[i + bytes + 1] : fill;
+		array[i] = offset ? (lower >> offset) | (upper << (8 - offset)) : lower;
+	}
+	return array;
+}
+
+RuntimeArray<unsigned char> &operator*=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	std::vector<unsigned long long> left = getWords(lhs), right = getWords(rhs);
+	std::vector<unsigned long long> product(left.size() + right.size());
+	multiplyWordArrays(left.data(), left.size(), right.data(), right.size(), product.data());
+	setWords(lhs, product);
+	return lhs;
+}
+
+const RuntimeArray<unsigned char> operator*(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	RuntimeArray<unsigned char> tmp = lhs;
+	tmp *= rhs;
+	return tmp;
+}
+
+RuntimeArray<unsigned char> &square(RuntimeArray<unsigned char> &array){
+	std::vector<unsigned long long> words = getWords(array);
+	std::vector<unsigned long long> product(2 * words.size());
+	if(!words.empty()) squareKaratsuba(words.data(), words.size(), product.data(), getMultiplicationDepth(words.size()));
+	setWords(array, product);
+	return array;
+}
+
+RuntimeArray<unsigned char> &operator/=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	unsigned long long divisor;
+	if(isSingleWord(rhs, divisor)){
+		divmodSmall(lhs, divisor);
+		return lhs;
+	}
+	RuntimeArray<unsigned char> remainder = lhs;
+	divideByWords(remainder, rhs, &lhs);
+	return lhs;
+}
+
+const RuntimeArray<unsigned char> operator/(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	RuntimeArray<unsigned char> tmp = lhs;
+	tmp /= rhs;
+	return tmp;
+}
+
+RuntimeArray<unsigned char> &operator%=(RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	unsigned long long divisor;
+	if(isSingleWord(rhs, divisor)){
+		unsigned long long remainder { modSmall(lhs, divisor) };
+		for(unsigned long long i = 0; i < lhs.length(); ++i, remainder >>= 8){
+			lhs[i] = static_cast<unsigned char>(remainder);
+		}
+		return lhs;
+	}
+	divideByWords(lhs, rhs, nullptr);
+	return lhs;
+}
+
+const RuntimeArray<unsigned char> operator%(const RuntimeArray<unsigned char> &lhs, const RuntimeArray<unsigned char> &rhs){
+	RuntimeArray<unsigned char> copy = lhs;
+	copy %= rhs;
+	return copy;
+}
+
+void multiplyWords(unsigned long long lhs, unsigned long long rhs, unsigned long long &high, unsigned long long &low){
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product { static_cast<unsigned __int128>(lhs) * rhs };
+	high = static_cast<unsigned long long>(product >> 64);
+	low = static_cast<unsigned long long>(product);
+#else
+	unsigned long long
+		lhsLow { lhs & 0xFFFFFFFF }, lhsHigh { lhs >> 32 },
+		rhsLow { rhs & 0xFFFFFFFF }, rhsHigh { rhs >> 32 },
+		lowLow { lhsLow * rhsLow },
+		middle { lhsHigh * rhsLow + (lowLow >> 32) },
+		middleTwo { lhsLow * rhsHigh + (middle & 0xFFFFFFFF) };
+	high = lhsHigh * rhsHigh + (middle >> 32) + (middleTwo >> 32);
+	low = (middleTwo << 32) | (lowLow & 0xFFFFFFFF);
+#endif
+}
+
+unsigned long long addWords(unsigned long long *lhs, const unsigned long long *rhs, std::size_t length){
+	unsigned long long carry { 0 };
+	for(std::size_t i = 0; i < length; ++i){
+		unsigned long long sum { lhs[i] + carry };
+		carry = sum < carry ? 1 : 0;
+		sum += rhs[i];
+		carry += sum < rhs[i] ? 1 : 0;
+		lhs[i] = sum;
+	}
+	return carry;
+}
+
+unsigned long long subtractWords(unsigned long long *lhs, const unsigned long long *rhs, std::size_t length){
+	unsigned long long borrow { 0 };
+	for(std::size_t i = 0; i < length; ++i){
+		unsigned long long difference { lhs[i] - rhs[i] - borrow };
+		borrow = (lhs[i] < rhs[i] || (lhs[i] == rhs[i] && borrow)) ? 1 : 0;
+		lhs[i] = difference;
+	}
+	return borrow;
+}
+
+void multiplyWordArrays(const unsigned long long *lhs, std::size_t lhsLength, const unsigned long long *rhs,
+		std::size_t rhsLength, unsigned long long *result){
+	if(!lhsLength || !rhsLength){
+		std::fill(result, result + lhsLength + rhsLength, 0);
+		return;
+	}
+	multiplyUnbalanced(lhs, lhsLength, rhs, rhsLength, result, getMultiplicationDepth(std::max(lhsLength, rhsLength)));
+}
+
+unsigned long long divmodSmall(RuntimeArray<unsigned char> &dividend, unsigned long long divisor){
+	return divideByWord(dividend, divisor, &dividend);
+}
+
+unsigned long long modSmall(const RuntimeArray<unsigned char> &dividend, unsigned long long divisor){
+	return divideByWord(dividend, divisor, nullptr);
+}
+
+}
+}
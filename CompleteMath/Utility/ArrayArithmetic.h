@@ -1,259 +1,456 @@
-/*
- * ArrayArithmetic.h
- *
- *  Created on: 16 lip 2015
- *      Author: Bartosz Miera
- */
-
-#ifndef UTILITY_ARRAYARITHMETIC_H_
-#define UTILITY_ARRAYARITHMETIC_H_
-
-#include "../Technical/RuntimeArray.h"
-
-namespace coma{
-namespace util{
-
-/**
- * @brief
- * 	Creates array of numbers without meaningless bytes.
- *
- * @param array
- * 	Array to copy inside.
- *
- * @param withSign
- * 	Tells if array contains sing or unsigned number.
- *
- * @return
- * 	Copy of given array w/o meaningless chars.
- */
-const tech::RuntimeArray<unsigned char> withoutMeaninglessChars(const tech::RuntimeArray<unsigned char> &array,
-		bool withSign);
-
-/**
- * @brief
- * 	Reverses the order of elements in array.
- *
- * @param toReverse
- * 	Array to have order reversed,
- *
- * @return
- * 	New array with reversed ordering.
- */
-const tech::RuntimeArray<unsigned char> reverse(const tech::RuntimeArray<unsigned char> &toReverse);
-
-/**
- * @brief
- * 	Negates array in place.
- *
- * @param toNegate
- * 	Array to negate.
- */
-void negate(tech::RuntimeArray<unsigned char> &toNegate);
-
-/**
- * @brief
- * 	Adds numbers in arrays in place.
- *
- * @param lhs
- * 	Number to which @a right is added.
- *
- * @param rhs
- * 	Number to add.
- *
- * @return
- * 	@a lhs after addition.
- */
-tech::RuntimeArray<unsigned char> &operator+=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Adds two numbers in arrays.
- *
- * @param lhs
- * 	Left operand.
- *
- * @param rhs
- * 	Right operand.
- *
- * @return
- * 	Array containing sum.
- */
-const tech::RuntimeArray<unsigned char> operator+(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Sibtracts numbers in arrays in place.
- *
- * @param lhs
- * 	Number from which @a right is subtracted.
- *
- * @param rhs
- * 	Number to subtract.
- *
- * @return
- * 	@a lhs after subtraction.
- */
-tech::RuntimeArray<unsigned char> &operator-=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Subtracts two numbers in arrays.
- *
- * @param lhs
- * 	Left operand.
- *
- * @param rhs
- * 	Right operand.
- *
- * @return
- * 	Array containing difference.
- */
-const tech::RuntimeArray<unsigned char> operator-(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Negates number in array.
- *
- * @param array
- * 	Array to negate.
- *
- * @return
- * 	Negation of @a array.
- */
-const tech::RuntimeArray<unsigned char> operator~(const tech::RuntimeArray<unsigned char> &array);
-
-/**
- * @brief
- * 	Negates number in array.
- *
- * @param array
- * 	Array to negate.
- *
- * @return
- * 	Arithmetic negation of @a array.
- */
-const tech::RuntimeArray<unsigned char> operator-(const tech::RuntimeArray<unsigned char> &array);
-
-/**
- * @brief
- * 	Shifts elements in array left.
- *
- * @param lhs
- * 	Array to shift.
- *
- * @param rhs
- * 	Number of elements to shift.
- *
- * @return
- * 	@a lhs after shift.
- */
-tech::RuntimeArray<unsigned char> &operator<<=(tech::RuntimeArray<unsigned char> &lhs, unsigned long long rhs);
-
-/**
- * @brief
- * 	Shifts elements in array left.
- *
- * @param lhs
- * 	Array to shift.
- *
- * @param rhs
- * 	Number of elements to shift.
- *
- * @return
- * 	 New array being result of shift.
- */
-const tech::RuntimeArray<unsigned char> operator<<(const tech::RuntimeArray<unsigned char> &lhs, unsigned long long rhs);
-
-/**
- * @brief
- * 	Multiplies numbers in arrays.
- *
- * @param lhs
- * 	Left operand.
- *
- * @param rhs
- * 	Right operand.
- *
- * @return
- * 	Product of @a lhs and @a rhs stored in @a lhs.
- */
-tech::RuntimeArray<unsigned char> &operator*=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Multiplies numbers in arrays.
- *
- * @param lhs
- * 	Left operand.
- *
- * @param rhs
- * 	Right operand.
- *
- * @return
- * 	Product of @a lhs and @a rhs.
- */
-const tech::RuntimeArray<unsigned char> operator*(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Divides @a lhs by @a rhs.
- *
- * @param lhs
- * 	Dividend.
- *
- * @param rhs
- * 	Divisor.
- *
- * @return
- * 	Quotient of @a lhs and @a rhs stored in @a lhs.
- */
-tech::RuntimeArray<unsigned char> &operator/=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Divides @a lhs by @a rhs.
- *
- * @param lhs
- * 	Dividend.
- *
- * @param rhs
- * 	Divisor.
- *
- * @return
- * 	Quotient of @a lhs and @a rhs.
- */
-const tech::RuntimeArray<unsigned char> operator/(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Gets remainder of division.
- *
- * @param lhs
- * 	Dividend.
- *
- * @param rhs
- * 	Divisor.
- *
- * @return
- * 	Remainder of division stored in @a lhs.
- */
-tech::RuntimeArray<unsigned char> &operator%=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-
-/**
- * @brief
- * 	Gets remainder of division.
- *
- * @param lhs
- * 	Dividend.
- *
- * @param rhs
- * 	Divisor.
- *
- * @return
- * 	Remainder of division.
- */
-const tech::RuntimeArray<unsigned char> operator%(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
-}
-}
-
-#endif /* UTILITY_ARRAYARITHMETIC_H_ */
+/*
+ * ArrayArithmetic.h
+ *
+ *  Created on: 16 lip 2015
+ *      Author: Bartosz Miera
+ */
+
+#ifndef UTILITY_ARRAYARITHMETIC_H_
+#define UTILITY_ARRAYARITHMETIC_H_
+
+#include "../Technical/RuntimeArray.h"
+
+namespace coma{
+namespace util{
+
+/**
+ * @brief
+ * 	Creates array of numbers without meaningless bytes.
+ *
+ * @param array
+ * 	Array to copy inside.
+ *
+ * @param withSign
+ * 	Tells if array contains sing or unsigned number.
+ *
+ * @return
+ * 	Copy of given array w/o meaningless chars.
+ */
+const tech::RuntimeArray<unsigned char> withoutMeaninglessChars(const tech::RuntimeArray<unsigned char> &array,
+		bool withSign);
+
+/**
+ * @brief
+ * 	Reverses the order of elements in array.
+ *
+ * @param toReverse
+ * 	Array to have order reversed,
+ *
+ * @return
+ * 	New array with reversed ordering.
+ */
+const tech::RuntimeArray<unsigned char> reverse(const tech::RuntimeArray<unsigned char> &toReverse);
+
+/**
+ * @brief
+ * 	Compares unsigned numbers stored in arrays. Arrays may differ in length.
+ *
+ * @param lhs
+ * 	Left operand.
+ *
+ * @param rhs
+ * 	Right operand.
+ *
+ * @return
+ * 	Positive value if @a lhs is greater, negative if @a rhs is greater, zero if numbers are equal.
+ */
+const int compare(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Negates array in place.
+ *
+ * @param toNegate
+ * 	Array to negate.
+ */
+void negate(tech::RuntimeArray<unsigned char> &toNegate);
+
+/**
+ * @brief
+ * 	Adds numbers in arrays in place.
+ *
+ * @param lhs
+ * 	Number to which @a right is added.
+ *
+ * @param rhs
+ * 	Number to add.
+ *
+ * @return
+ * 	@a lhs after addition.
+ */
+tech::RuntimeArray<unsigned char> &operator+=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Adds two numbers in arrays.
+ *
+ * @param lhs
+ * 	Left operand.
+ *
+ * @param rhs
+ * 	Right operand.
+ *
+ * @return
+ * 	Array containing sum.
+ */
+const tech::RuntimeArray<unsigned char> operator+(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Sibtracts numbers in arrays in place.
+ *
+ * @param lhs
+ * 	Number from which @a right is subtracted.
+ *
+ * @param rhs
+ * 	Number to subtract.
+ *
+ * @return
+ * 	@a lhs after subtraction.
+ */
+tech::RuntimeArray<unsigned char> &operator-=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Subtracts two numbers in arrays.
+ *
+ * @param lhs
+ * 	Left operand.
+ *
+ * @param rhs
+ * 	Right operand.
+ *
+ * @return
+ * 	Array containing difference.
+ */
+const tech::RuntimeArray<unsigned char> operator-(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Negates number in array.
+ *
+ * @param array
+ * 	Array to negate.
+ *
+ * @return
+ * 	Negation of @a array.
+ */
+const tech::RuntimeArray<unsigned char> operator~(const tech::RuntimeArray<unsigned char> &array);
+
+/**
+ * @brief
+ * 	Negates number in array.
+ *
+ * @param array
+ * 	Array to negate.
+ *
+ * @return
+ * 	Arithmetic negation of @a array.
+ */
+const tech::RuntimeArray<unsigned char> operator-(const tech::RuntimeArray<unsigned char> &array);
+
+/**
+ * @brief
+ * 	Shifts elements in array left.
+ *
+ * @param lhs
+ * 	Array to shift.
+ *
+ * @param rhs
+ * 	Number of elements to shift.
+ *
+ * @return
+ * 	@a lhs after shift.
+ */
+tech::RuntimeArray<unsigned char> &operator<<=(tech::RuntimeArray<unsigned char> &lhs, unsigned long long rhs);
+
+/**
+ * @brief
+ * 	Shifts elements in array left.
+ *
+ * @param lhs
+ * 	Array to shift.
+ *
+ * @param rhs
+ * 	Number of elements to shift.
+ *
+ * @return
+ * 	 New array being result of shift.
+ */
+const tech::RuntimeArray<unsigned char> operator<<(const tech::RuntimeArray<unsigned char> &lhs, unsigned long long rhs);
+
+/**
+ * @brief
+ * 	Shifts number in array left by given amount of bits in place.
+ *
+ * @details
+ * 	Bits shifted out of the array are lost.
+ *
+ * @param array
+ * 	Array to shift.
+ *
+ * @param bits
+ * 	Number of bits to shift.
+ *
+ * @return
+ * 	@a array after shift.
+ */
+tech::RuntimeArray<unsigned char> &shiftBitsLeft(tech::RuntimeArray<unsigned char> &array, unsigned long long bits);
+
+/**
+ * @brief
+ * 	Shifts number in array right by given amount of bits in place.
+ *
+ * @param array
+ * 	Array to shift.
+ *
+ * @param bits
+ * 	Number of bits to shift.
+ *
+ * @param withSign
+ * 	Tells if array contains signed number. For signed numbers the sign bit is copied into vacated bits.
+ *
+ * @return
+ * 	@a array after shift.
+ */
+tech::RuntimeArray<unsigned char> &shiftBitsRight(tech::RuntimeArray<unsigned char> &array, unsigned long long bits,
+		bool withSign = false);
+
+/**
+ * @brief
+ * 	Multiplies numbers in arrays.
+ *
+ * @details
+ * 	Product is computed on 64 bit words with schoolbook method for short operands and Karatsuba method for long
+ * 	ones. Independent Karatsuba subproducts of very long operands are computed in parallel, using at most
+ * 	tech::getThreadCount() threads. Result is truncated to the length of @a lhs.
+ *
+ * @param lhs
+ * 	Left operand.
+ *
+ * @param rhs
+ * 	Right operand.
+ *
+ * @return
+ * 	Product of @a lhs and @a rhs stored in @a lhs.
+ */
+tech::RuntimeArray<unsigned char> &operator*=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Multiplies numbers in arrays.
+ *
+ * @param lhs
+ * 	Left operand.
+ *
+ * @param rhs
+ * 	Right operand.
+ *
+ * @return
+ * 	Product of @a lhs and @a rhs.
+ */
+const tech::RuntimeArray<unsigned char> operator*(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Squares number in array in place.
+ *
+ * @details
+ * 	Every cross product is computed once and doubled, so squaring costs about half of general multiplication.
+ * 	Long numbers are squared with Karatsuba method, whose three subproducts are squares too. Just like in
+ * 	operator*=() result is truncated to the length of @a array.
+ *
+ * @param array
+ * 	Number to square.
+ *
+ * @return
+ * 	Square of @a array stored in @a array.
+ */
+tech::RuntimeArray<unsigned char> &square(tech::RuntimeArray<unsigned char> &array);
+
+/**
+ * @brief
+ * 	Divides @a lhs by @a rhs.
+ *
+ * @details
+ * 	Divisors up to 8 bytes long use divmodSmall(), longer ones schoolbook division on 64 bit words.
+ *
+ * @param lhs
+ * 	Dividend.
+ *
+ * @param rhs
+ * 	Divisor.
+ *
+ * @return
+ * 	Quotient of @a lhs and @a rhs stored in @a lhs.
+ */
+tech::RuntimeArray<unsigned char> &operator/=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Divides @a lhs by @a rhs.
+ *
+ * @param lhs
+ * 	Dividend.
+ *
+ * @param rhs
+ * 	Divisor.
+ *
+ * @return
+ * 	Quotient of @a lhs and @a rhs.
+ */
+const tech::RuntimeArray<unsigned char> operator/(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Gets remainder of division.
+ *
+ * @details
+ * 	Uses the same algorithms as operator/=().
+ *
+ * @param lhs
+ * 	Dividend.
+ *
+ * @param rhs
+ * 	Divisor.
+ *
+ * @return
+ * 	Remainder of division stored in @a lhs.
+ */
+tech::RuntimeArray<unsigned char> &operator%=(tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Gets remainder of division.
+ *
+ * @param lhs
+ * 	Dividend.
+ *
+ * @param rhs
+ * 	Divisor.
+ *
+ * @return
+ * 	Remainder of division.
+ */
+const tech::RuntimeArray<unsigned char> operator%(const tech::RuntimeArray<unsigned char> &lhs, const tech::RuntimeArray<unsigned char> &rhs);
+
+/**
+ * @brief
+ * 	Multiplies two words.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor.
+ *
+ * @param high
+ * 	Variable for the more significant word of product.
+ *
+ * @param low
+ * 	Variable for the less significant word of product.
+ */
+void multiplyWords(unsigned long long lhs, unsigned long long rhs, unsigned long long &high, unsigned long long &low);
+
+/**
+ * @brief
+ * 	Adds words of @a rhs to words of @a lhs in place.
+ *
+ * @param lhs
+ * 	Little-endian words of first addend and sum.
+ *
+ * @param rhs
+ * 	Little-endian words of second addend.
+ *
+ * @param length
+ * 	Number of words of both addends.
+ *
+ * @return
+ * 	Carry out of the most significant word.
+ */
+unsigned long long addWords(unsigned long long *lhs, const unsigned long long *rhs, std::size_t length);
+
+/**
+ * @brief
+ * 	Subtracts words of @a rhs from words of @a lhs in place.
+ *
+ * @param lhs
+ * 	Little-endian words of minuend and difference.
+ *
+ * @param rhs
+ * 	Little-endian words of subtrahend.
+ *
+ * @param length
+ * 	Number of words of both operands.
+ *
+ * @return
+ * 	Borrow out of the most significant word.
+ */
+unsigned long long subtractWords(unsigned long long *lhs, const unsigned long long *rhs, std::size_t length);
+
+/**
+ * @brief
+ * 	Multiplies unsigned numbers stored in 64 bit words.
+ *
+ * @details
+ * 	The same algorithms as in operator*=() are used, but no conversion from bytes is needed.
+ *
+ * @param lhs
+ * 	Little-endian words of first factor.
+ *
+ * @param lhsLength
+ * 	Number of words of @a lhs.
+ *
+ * @param rhs
+ * 	Little-endian words of second factor.
+ *
+ * @param rhsLength
+ * 	Number of words of @a rhs.
+ *
+ * @param result
+ * 	Buffer of @a lhsLength + @a rhsLength words for product, distinct from factors.
+ */
+void multiplyWordArrays(const unsigned long long *lhs, std::size_t lhsLength, const unsigned long long *rhs,
+		std::size_t rhsLength, unsigned long long *result);
+
+/**
+ * @brief
+ * 	Divides @a dividend by single word divisor.
+ *
+ * @details
+ * 	Dividend is processed in 64 bit words. Each step divides two words by normalized divisor with its
+ * 	precomputed reciprocal (Moller-Granlund), which costs two multiplications instead of any division.
+ * 	operator/=() and operator%=() use it for divisors up to 8 bytes long.
+ *
+ * @param dividend
+ * 	Unsigned dividend.
+ *
+ * @param divisor
+ * 	Non-zero divisor.
+ *
+ * @return
+ * 	Remainder of division. Quotient is stored in @a dividend.
+ */
+unsigned long long divmodSmall(tech::RuntimeArray<unsigned char> &dividend, unsigned long long divisor);
+
+/**
+ * @brief
+ * 	Gets remainder of division by single word divisor.
+ *
+ * @details
+ * 	Works like divmodSmall(), but leaves @a dividend untouched.
+ *
+ * @param dividend
+ * 	Unsigned dividend.
+ *
+ * @param divisor
+ * 	Non-zero divisor.
+ *
+ * @return
+ * 	@a dividend mod @a divisor.
+ */
+unsigned long long modSmall(const tech::RuntimeArray<unsigned char> &dividend, unsigned long long divisor);
+}
+}
+
+#endif /* UTILITY_ARRAYARITHMETIC_H_ */
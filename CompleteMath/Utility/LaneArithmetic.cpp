@@ -0,0 +1,408 @@
+/*
+ * LaneArithmetic.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "LaneArithmetic.h"
+#include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#	define LANES_X86
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#	endif
+#endif
+
+#ifdef __GNUC__
+#	define TARGET_AVX2 __attribute__((target("avx2")))
+#	define TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#	define TARGET_AVX2
+#	define TARGET_AVX512
+#endif
+
+namespace coma{
+namespace util{
+
+namespace{
+
+/**
+ * @brief
+ * 	Checks which instructions are supported by processor and operating system.
+ *
+ * @return
+ * 	The best supported instructions.
+ */
+LaneKernels getSupportedKernels() noexcept{
+#if defined(LANES_X86) && defined(__GNUC__)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512f")) return LaneKernels::AVX512;
+	if(__builtin_cpu_supports("avx2")) return LaneKernels::AVX2;
+#elif defined(LANES_X86) && defined(_MSC_VER)
+	int registers[4];
+	__cpuid(registers, 1);
+	//operating system has to save AVX registers (OSXSAVE and XCR0 bits)
+	if(!(registers[2] & (1 << 27))) return LaneKernels::Scalar;
+	unsigned long long features { _xgetbv(0) };
+	__cpuidex(registers, 7, 0);
+	if((registers[1] & (1 << 16)) && (features & 0xE6) == 0xE6) return LaneKernels::AVX512;
+	if((registers[1] & (1 << 5)) && (features & 0x6) == 0x6) return LaneKernels::AVX2;
+#endif
+	return LaneKernels::Scalar;
+}
+
+/**
+ * @brief
+ * 	The best instructions supported by processor.
+ */
+const LaneKernels supportedKernels { getSupportedKernels() };
+
+/**
+ * @brief
+ * 	Instructions used by kernels.
+ */
+std::atomic<LaneKernels> selectedKernels { supportedKernels };
+
+/**
+ * @brief
+ * 	Adds pairs of numbers from given lane to the end with scalar code.
+ *
+ * @param lhs
+ * 	First addends.
+ *
+ * @param rhs
+ * 	Second addends.
+ *
+ * @param result
+ * 	Buffer for sums.
+ *
+ * @param width
+ * 	Number of words of every number.
+ *
+ * @param count
+ * 	Number of pairs.
+ *
+ * @param begin
+ * 	Index of the first lane.
+ */
+void addScalar(const unsigned long long *lhs, const unsigned long long *rhs, unsigned long long *result,
+		std::size_t width, std::size_t count, std::size_t begin){
+	for(std::size_t i = begin; i < count; ++i){
+		unsigned long long carry { 0 };
+		for(std::size_t j = i; j < width * count; j += count){
+			unsigned long long sum { lhs[j] + carry };
+			carry = sum < carry ? 1 : 0;
+			sum += rhs[j];
+			carry += sum < rhs[j] ? 1 : 0;
+			result[j] = sum;
+		}
+	}
+}
+
+/**
+ * @brief
+ * 	Subtracts pairs of numbers from given lane to the end with scalar code.
+ *
+ * @copydetails addScalar
+ */
+void subtractScalar(const unsigned long long *lhs, const unsigned long long *rhs, unsigned long long *result,
+		std::size_t width, std::size_t count, std::size_t begin){
+	for(std::size_t i = begin; i < count; ++i){
+		unsigned long long borrow { 0 };
+		for(std::size_t j = i; j < width * count; j += count){
+			unsigned long long left { lhs[j] }, right { rhs[j] };
+			result[j] = left - right - borrow;
+			borrow = (left < right || (left == right && borrow)) ? 1 : 0;
+		}
+	}
+}
+
+/**
+ * @brief
+ * 	Compares pairs of numbers from given lane to the end with scalar code.
+ *
+ * @param lhs
+ * 	Left operands.
+ *
+ * @param rhs
+ * 	Right operands.
+ *
+ * @param result
+ * 	Buffer for results of comparisons.
+ *
+ * @param width
+ * 	Number of words of every number.
+ *
+ * @param count
+ * 	Number of pairs.
+ *
+ * @param begin
+ * 	Index of the first lane.
+ */
+void compareScalar(const unsigned long long *lhs, const unsigned long long *rhs, signed char *result,
+		std::size_t width, std::size_t count, std::size_t begin){
+	for(std::size_t i = begin; i < count; ++i){
+		result[i] = 0;
+		for(std::size_t j = width; j-- > 0;){
+			unsigned long long left { lhs[j * count + i] }, right { rhs[j * count + i] };
+			if(left == right) continue;
+			//the most significant word holds sign
+			if(j == width - 1) result[i] = static_cast<long long>(left) < static_cast<long long>(right) ? -1 : 1;
+			else result[i] = left < right ? -1 : 1;
+			break;
+		}
+	}
+}
+
+#ifdef LANES_X86
+
+/**
+ * @brief
+ * 	Compares words of four lanes as unsigned numbers.
+ *
+ * @details
+ * 	AVX2 has only signed comparison, so sign bits of both operands are flipped first.
+ *
+ * @param lhs
+ * 	Left words.
+ *
+ * @param rhs
+ * 	Right words.
+ *
+ * @return
+ * 	All ones in lanes where @a lhs is greater than @a rhs, zeroes in others.
+ */
+TARGET_AVX2 __m256i isGreaterAVX2(__m256i lhs, __m256i rhs){
+	const __m256i sign { _mm256_set1_epi64x(static_cast<long long>(1ull << 63)) };
+	return _mm256_cmpgt_epi64(_mm256_xor_si256(lhs, sign), _mm256_xor_si256(rhs, sign));
+}
+
+/**
+ * @brief
+ * 	Adds pairs of numbers in groups of four lanes with AVX2.
+ *
+ * @return
+ * 	Index of the first lane which was not processed.
+ */
+TARGET_AVX2 std::size_t addAVX2(const unsigned long long *lhs, const unsigned long long *rhs,
+		unsigned long long *result, std::size_t width, std::size_t count){
+	std::size_t i { 0 };
+	for(; i + 4 <= count; i += 4){
+		//carry is all ones in lanes with carry, subtracting it adds one
+		__m256i carry { _mm256_setzero_si256() };
+		for(std::size_t j = i; j < width * count; j += count){
+			__m256i
+				left { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + j)) },
+				right { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + j)) },
+				sum { _mm256_add_epi64(left, right) },
+				overflow { isGreaterAVX2(left, sum) },
+				total { _mm256_sub_epi64(sum, carry) };
+			carry = _mm256_or_si256(overflow, _mm256_and_si256(carry, _mm256_cmpeq_epi64(total, _mm256_setzero_si256())));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(result + j), total);
+		}
+	}
+	return i;
+}
+
+/**
+ * @brief
+ * 	Subtracts pairs of numbers in groups of four lanes with AVX2.
+ *
+ * @return
+ * 	Index of the first lane which was not processed.
+ */
+TARGET_AVX2 std::size_t subtractAVX2(const unsigned long long *lhs, const unsigned long long *rhs,
+		unsigned long long *result, std::size_t width, std::size_t count){
+	std::size_t i { 0 };
+	for(; i + 4 <= count; i += 4){
+		//borrow is all ones in lanes with borrow, adding it subtracts one
+		__m256i borrow { _mm256_setzero_si256() };
+		for(std::size_t j = i; j < width * count; j += count){
+			__m256i
+				left { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + j)) },
+				right { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + j)) },
+				difference { _mm256_sub_epi64(left, right) },
+				underflow { isGreaterAVX2(right, left) };
+			underflow = _mm256_or_si256(underflow, _mm256_and_si256(borrow, _mm256_cmpeq_epi64(difference, _mm256_setzero_si256())));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(result + j), _mm256_add_epi64(difference, borrow));
+			borrow = underflow;
+		}
+	}
+	return i;
+}
+
+/**
+ * @brief
+ * 	Compares pairs of numbers in groups of four lanes with AVX2.
+ *
+ * @return
+ * 	Index of the first lane which was not processed.
+ */
+TARGET_AVX2 std::size_t compareAVX2(const unsigned long long *lhs, const unsigned long long *rhs,
+		signed char *result, std::size_t width, std::size_t count){
+	std::size_t i { 0 };
+	for(; i + 4 <= count; i += 4){
+		__m256i greater { _mm256_setzero_si256() }, lesser { _mm256_setzero_si256() };
+		for(std::size_t j = width; j-- > 0;){
+			__m256i
+				left { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + j * count + i)) },
+				right { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + j * count + i)) },
+				isGreater { j == width - 1 ? _mm256_cmpgt_epi64(left, right) : isGreaterAVX2(left, right) },
+				isLesser { j == width - 1 ? _mm256_cmpgt_epi64(right, left) : isGreaterAVX2(right, left) },
+				undecided { _mm256_xor_si256(_mm256_or_si256(greater, lesser), _mm256_set1_epi64x(-1)) };
+			greater = _mm256_or_si256(greater, _mm256_and_si256(undecided, isGreater));
+			lesser = _mm256_or_si256(lesser, _mm256_and_si256(undecided, isLesser));
+		}
+		int greaterMask { _mm256_movemask_pd(_mm256_castsi256_pd(greater)) };
+		int lesserMask { _mm256_movemask_pd(_mm256_castsi256_pd(lesser)) };
+		for(std::size_t k = 0; k < 4; ++k){
+			result[i + k] = static_cast<signed char>(((greaterMask >> k) & 1) - ((lesserMask >> k) & 1));
+		}
+	}
+	return i;
+}
+
+/**
+ * @brief
+ * 	Adds pairs of numbers in groups of eight lanes with AVX-512.
+ *
+ * @return
+ * 	Index of the first lane which was not processed.
+ */
+TARGET_AVX512 std::size_t addAVX512(const unsigned long long *lhs, const unsigned long long *rhs,
+		unsigned long long *result, std::size_t width, std::size_t count){
+	const __m512i one { _mm512_set1_epi64(1) };
+	std::size_t i { 0 };
+	for(; i + 8 <= count; i += 8){
+		__mmask8 carry { 0 };
+		for(std::size_t j = i; j < width * count; j += count){
+			__m512i
+				left { _mm512_loadu_si512(lhs + j) },
+				right { _mm512_loadu_si512(rhs + j) },
+				sum { _mm512_add_epi64(left, right) };
+			__mmask8 overflow { _mm512_cmplt_epu64_mask(sum, left) };
+			sum = _mm512_mask_add_epi64(sum, carry, sum, one);
+			carry = overflow | _mm512_mask_cmpeq_epi64_mask(carry, sum, _mm512_setzero_si512());
+			_mm512_storeu_si512(result + j, sum);
+		}
+	}
+	return i;
+}
+
+/**
+ * @brief
+ * 	Subtracts pairs of numbers in groups of eight lanes with AVX-512.
+ *
+ * @return
+ * 	Index of the first lane which was not processed.
+ */
+TARGET_AVX512 std::size_t subtractAVX512(const unsigned long long *lhs, const unsigned long long *rhs,
+		unsigned long long *result, std::size_t width, std::size_t count){
+	const __m512i one { _mm512_set1_epi64(1) };
+	std::size_t i { 0 };
+	for(; i + 8 <= count; i += 8){
+		__mmask8 borrow { 0 };
+		for(std::size_t j = i; j < width * count; j += count){
+			__m512i
+				left { _mm512_loadu_si512(lhs + j) },
+				right { _mm512_loadu_si512(rhs + j) },
+				difference { _mm512_sub_epi64(left, right) };
+			__mmask8 underflow { _mm512_cmplt_epu64_mask(left, right) };
+			underflow |= _mm512_mask_cmpeq_epi64_mask(borrow, difference, _mm512_setzero_si512());
+			difference = _mm512_mask_sub_epi64(difference, borrow, difference, one);
+			borrow = underflow;
+			_mm512_storeu_si512(result + j, difference);
+		}
+	}
+	return i;
+}
+
+/**
+ * @brief
+ * 	Compares pairs of numbers in groups of eight lanes with AVX-512.
+ *
+ * @return
+ * 	Index of the first lane which was not processed.
+ */
+TARGET_AVX512 std::size_t compareAVX512(const unsigned long long *lhs, const unsigned long long *rhs,
+		signed char *result, std::size_t width, std::size_t count){
+	std::size_t i { 0 };
+	for(; i + 8 <= count; i += 8){
+		__mmask8 greater { 0 }, lesser { 0 };
+		for(std::size_t j = width; j-- > 0;){
+			__m512i
+				left { _mm512_loadu_si512(lhs + j * count + i) },
+				right { _mm512_loadu_si512(rhs + j * count + i) };
+			__mmask8 undecided = static_cast<__mmask8>(~(greater | lesser));
+			if(j == width - 1){
+				greater |= _mm512_mask_cmpgt_epi64_mask(undecided, left, right);
+				lesser |= _mm512_mask_cmplt_epi64_mask(undecided, left, right);
+			}else{
+				greater |= _mm512_mask_cmpgt_epu64_mask(undecided, left, right);
+				lesser |= _mm512_mask_cmplt_epu64_mask(undecided, left, right);
+			}
+		}
+		for(std::size_t k = 0; k < 8; ++k){
+			result[i + k] = static_cast<signed char>(((greater >> k) & 1) - ((lesser >> k) & 1));
+		}
+	}
+	return i;
+}
+
+#endif
+
+}
+
+LaneKernels getLaneKernels() noexcept{
+	return selectedKernels.load();
+}
+
+void setLaneKernels(LaneKernels kernels) noexcept{
+	selectedKernels.store(std::min(kernels, supportedKernels));
+}
+
+void addLanes(const unsigned long long *lhs, const unsigned long long *rhs, unsigned long long *result,
+		std::size_t width, std::size_t count){
+	std::size_t begin { 0 };
+#ifdef LANES_X86
+	switch(getLaneKernels()){
+	case LaneKernels::AVX512: begin = addAVX512(lhs, rhs, result, width, count); break;
+	case LaneKernels::AVX2: begin = addAVX2(lhs, rhs, result, width, count); break;
+	default: break;
+	}
+#endif
+	addScalar(lhs, rhs, result, width, count, begin);
+}
+
+void subtractLanes(const unsigned long long *lhs, const unsigned long long *rhs, unsigned long long *result,
+		std::size_t width, std::size_t count){
+	std::size_t begin { 0 };
+#ifdef LANES_X86
+	switch(getLaneKernels()){
+	case LaneKernels::AVX512: begin = subtractAVX512(lhs, rhs, result, width, count); break;
+	case LaneKernels::AVX2: begin = subtractAVX2(lhs, rhs, result, width, count); break;
+	default: break;
+	}
+#endif
+	subtractScalar(lhs, rhs, result, width, count, begin);
+}
+
+void compareLanes(const unsigned long long *lhs, const unsigned long long *rhs, signed char *result,
+		std::size_t width, std::size_t count){
+	std::size_t begin { 0 };
+#ifdef LANES_X86
+	switch(getLaneKernels()){
+	case LaneKernels::AVX512: begin = compareAVX512(lhs, rhs, result, width, count); break;
+	case LaneKernels::AVX2: begin = compareAVX2(lhs, rhs, result, width, count); break;
+	default: break;
+	}
+#endif
+	compareScalar(lhs, rhs, result, width, count, begin);
+}
+
+}
+}
@@ -0,0 +1,125 @@
+/*
+ * LaneArithmetic.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef UTILITY_LANEARITHMETIC_H_
+#define UTILITY_LANEARITHMETIC_H_
+
+#include <cstddef>
+
+namespace coma{
+namespace util{
+
+/**
+ * @brief
+ * 	Sets of instructions used by lane kernels.
+ */
+enum class LaneKernels{
+	Scalar,//!< Scalar portable code
+	AVX2,  //!< AVX2, four lanes at once
+	AVX512 //!< AVX-512F, eight lanes at once
+};
+
+/**
+ * @brief
+ * 	Gets instructions used by lane kernels.
+ *
+ * @return
+ * 	The best instructions supported by processor, unless they were limited by setLaneKernels().
+ */
+LaneKernels getLaneKernels() noexcept;
+
+/**
+ * @brief
+ * 	Limits instructions used by lane kernels, for example to compare results or speed of implementations.
+ *
+ * @param kernels
+ * 	Requested instructions. If processor does not support them, the best supported ones are used.
+ */
+void setLaneKernels(LaneKernels kernels) noexcept;
+
+/**
+ * @brief
+ * 	Adds many pairs of fixed width numbers.
+ *
+ * @details
+ * 	Numbers are stored in transposed layout: word j of number i is at index j * @a count + i, so consecutive
+ * 	memory holds the same word of consecutive numbers. Carries are then propagated in all lanes of vector
+ * 	registers at once. Numbers are two's complement, sums wrap around modulo 2^(64 * @a width).
+ *
+ * @param lhs
+ * 	First addends.
+ *
+ * @param rhs
+ * 	Second addends.
+ *
+ * @param result
+ * 	Buffer for sums of @a width * @a count words, may be the same as an operand.
+ *
+ * @param width
+ * 	Number of words of every number.
+ *
+ * @param count
+ * 	Number of pairs.
+ */
+void addLanes(const unsigned long long *lhs, const unsigned long long *rhs, unsigned long long *result,
+		std::size_t width, std::size_t count);
+
+/**
+ * @brief
+ * 	Subtracts many pairs of fixed width numbers.
+ *
+ * @details
+ * 	Layout is the same as in addLanes(), differences wrap around modulo 2^(64 * @a width).
+ *
+ * @param lhs
+ * 	Minuends.
+ *
+ * @param rhs
+ * 	Subtrahends.
+ *
+ * @param result
+ * 	Buffer for differences of @a width * @a count words, may be the same as an operand.
+ *
+ * @param width
+ * 	Number of words of every number.
+ *
+ * @param count
+ * 	Number of pairs.
+ */
+void subtractLanes(const unsigned long long *lhs, const unsigned long long *rhs, unsigned long long *result,
+		std::size_t width, std::size_t count);
+
+/**
+ * @brief
+ * 	Compares many pairs of fixed width signed numbers.
+ *
+ * @details
+ * 	Layout is the same as in addLanes().
+ *
+ * @param lhs
+ * 	Left operands.
+ *
+ * @param rhs
+ * 	Right operands.
+ *
+ * @param result
+ * 	Buffer of @a count values: positive if left number is greater, negative if right number is greater and
+ * 	zero if numbers are equal.
+ *
+ * @param width
+ * 	Number of words of every number.
+ *
+ * @param count
+ * 	Number of pairs.
+ */
+void compareLanes(const unsigned long long *lhs, const unsigned long long *rhs, signed char *result,
+		std::size_t width, std::size_t count);
+
+}
+}
+
+#endif /* UTILITY_LANEARITHMETIC_H_ */
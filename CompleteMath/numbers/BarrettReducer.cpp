@@ -0,0 +1,139 @@
+/*
+ * BarrettReducer.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "BarrettReducer.h"
+#include "Unsigned.h"
+#include "Signed.h"
+
+#include "../Utility/ArrayArithmetic.h"
+
+#include <algorithm>
+
+namespace coma {
+namespace numb {
+
+namespace{
+using Array = tech::RuntimeArray<unsigned char>;
+
+/**
+ * @brief
+ * 	Gets @a length least significant bytes of number. Missing bytes are filled with zeroes.
+ *
+ * @param number
+ * 	Number stored in array.
+ *
+ * @param length
+ * 	Number of bytes to take.
+ *
+ * @return
+ * 	@a number mod 256^@a length.
+ */
+Array lowerPart(const Array &number, unsigned long long length){
+	Array result(length);
+	for(unsigned long long i = 0; i < length && i < number.length(); ++i) result[i] = number[i];
+	return result;
+}
+
+/**
+ * @brief
+ * 	Drops @a shift least significant bytes of number.
+ *
+ * @param number
+ * 	Number stored in array.
+ *
+ * @param shift
+ * 	Number of bytes to drop.
+ *
+ * @return
+ * 	@a number / 256^@a shift.
+ */
+Array upperPart(const Array &number, unsigned long long shift){
+	if(shift >= number.length()) return Array(1);
+	return Array(number.cStyleArray() + shift, number.length() - shift);
+}
+
+}
+
+BarrettReducer::BarrettReducer(Pointer<Integer> modulus) :
+		m_modulus{modulus},
+		m_magnitude(1),
+		m_reciprocal(1){
+	//invalid reducer keeps zero modulus, so getRemainder() reports division by zero
+	if(!modulus){
+		REPORT_CONSTRUCTOR_ERROR(std::exception("Null pointer exception"), m_modulus = Number::ZERO());
+	}
+	if(modulus->isZero()){
+		REPORT_CONSTRUCTOR_ERROR(std::exception("Division by zero exception"), m_modulus = Number::ZERO());
+	}
+	using namespace util;
+	m_magnitude = getMagnitude(*modulus);
+	unsigned long long k { m_magnitude.length() };
+	m_reciprocal = Array(2 * k + 1);
+	m_reciprocal[2 * k] = 1;
+	m_reciprocal /= m_magnitude;
+	m_reciprocal = withoutMeaninglessChars(m_reciprocal, false);
+}
+
+Pointer<Integer> BarrettReducer::getRemainder(Pointer<Integer> dividend) const{
+	if(!dividend) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(m_modulus->isZero()) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
+	Array number = getMagnitude(*dividend);
+	unsigned long long k { m_magnitude.length() };
+	Array remainder(1);
+	if(number.length() <= 2 * k){
+		remainder = reduce(number);
+	}else{
+		remainder = Array(k);
+		for(unsigned long long chunk = (number.length() + k - 1) / k; chunk-- > 0;){
+			Array combined(2 * k);
+			for(unsigned long long i = 0; i < k && chunk * k + i < number.length(); ++i){
+				combined[i] = number[chunk * k + i];
+			}
+			for(unsigned long long i = 0; i < k; ++i) combined[k + i] = remainder[i];
+			remainder = reduce(combined);
+		}
+	}
+	if(dividend->isNegative() != m_modulus->isNegative() && !dividend->isZero()){
+		Array tmp = util::withoutMeaninglessChars(remainder, false);
+		if(tmp.length() > 1 || tmp[0] != 0){
+			using namespace util;
+			Array complement = lowerPart(m_magnitude, k + 1);
+			complement -= remainder;
+			remainder = complement;
+		}
+	}
+	return Unsigned::fromLittleEndianArray(remainder);
+}
+
+Pointer<Integer> BarrettReducer::getModulus() const noexcept{
+	return m_modulus;
+}
+
+Array BarrettReducer::getMagnitude(const Integer &number){
+	return util::withoutMeaninglessChars(number.getArray(), false);
+}
+
+Array BarrettReducer::reduce(const Array &number) const{
+	using namespace util;
+	unsigned long long k { m_magnitude.length() };
+	Array quotient = upperPart(number, k - 1);
+	Array estimate(quotient.length() + m_reciprocal.length());
+	std::copy(quotient.begin(), quotient.end(), estimate.begin());
+	estimate *= m_reciprocal;
+	quotient = upperPart(estimate, k + 1);
+	Array product = lowerPart(quotient, k + 1);
+	product *= m_magnitude;
+	Array remainder = lowerPart(number, k + 1);
+	remainder -= product;
+	while(compare(remainder, m_magnitude) >= 0){
+		remainder -= m_magnitude;
+	}
+	return remainder;
+}
+
+} /* namespace numb */
+} /* namespace coma */
@@ -0,0 +1,110 @@
+/*
+ * BarrettReducer.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_BARRETTREDUCER_H_
+#define NUMBERS_BARRETTREDUCER_H_
+
+#include "Integer.h"
+#include "../Technical/RuntimeArray.h"
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Reduces many Integers by one fixed modulus using Barrett reduction.
+ *
+ * @details
+ * 	Reciprocal of the modulus is computed once in constructor. Every following reduction of a number smaller than
+ * 	256^(2k), where k is length of the modulus in bytes, costs two multiplications instead of a long division.
+ * 	Longer numbers are reduced in k-byte chunks, starting from the most significant one.
+ */
+class BarrettReducer {
+public:
+	/**
+	 * @brief
+	 * 	Creates reducer for given modulus and precomputes its reciprocal.
+	 *
+	 * @param modulus
+	 * 	Non-zero modulus. For negative modulus its absolute value is used for reduction, while the sign of result
+	 * 	follows Signed::getRemainder(). For null or zero modulus error is reported and zero is stored as
+	 * 	modulus, so every following getRemainder() reports division by zero.
+	 */
+	explicit BarrettReducer(Pointer<Integer> modulus);
+
+	/**
+	 * @brief
+	 * 	Function to perform mod operation with stored modulus.
+	 *
+	 * @details
+	 * 	Gives the same result as @c dividend->getRemainder(getModulus()).
+	 *
+	 * @param dividend
+	 * 	Integer to be reduced.
+	 *
+	 * @return
+	 * 	Remainder of @a dividend and modulus division.
+	 */
+	Pointer<Integer> getRemainder(Pointer<Integer> dividend) const;
+
+	/**
+	 * @brief
+	 * 	Modulus getter.
+	 *
+	 * @return
+	 * 	Modulus used for reductions.
+	 */
+	Pointer<Integer> getModulus() const noexcept;
+
+private:
+	/**
+	 * @brief
+	 * 	Gets absolute value of given Integer.
+	 *
+	 * @param number
+	 * 	Integer which absolute value is taken.
+	 *
+	 * @return
+	 * 	Array containing absolute value of @a number without meaningless bytes.
+	 */
+	static tech::RuntimeArray<unsigned char> getMagnitude(const Integer &number);
+
+	/**
+	 * @brief
+	 * 	Reduces number smaller than 256^(2k).
+	 *
+	 * @param number
+	 * 	Magnitude of number to reduce, at most 2k bytes long.
+	 *
+	 * @return
+	 * 	Remainder of @a number and modulus division, k + 1 bytes long.
+	 */
+	tech::RuntimeArray<unsigned char> reduce(const tech::RuntimeArray<unsigned char> &number) const;
+
+	/**
+	 * @brief
+	 * 	Modulus as passed to constructor.
+	 */
+	Pointer<Integer> m_modulus;
+
+	/**
+	 * @brief
+	 * 	Absolute value of modulus without meaningless bytes.
+	 */
+	tech::RuntimeArray<unsigned char> m_magnitude;
+
+	/**
+	 * @brief
+	 * 	Precomputed floor(256^(2k) / modulus).
+	 */
+	tech::RuntimeArray<unsigned char> m_reciprocal;
+};
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_BARRETTREDUCER_H_ */
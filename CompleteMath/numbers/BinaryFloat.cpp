@@ -0,0 +1,451 @@
+/*
+ * BinaryFloat.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "BinaryFloat.h"
+#include "FloatingPoint.h"
+#include "Unsigned.h"
+#include "Signed.h"
+
+#include "../Utility/ArrayArithmetic.h"
+
+#include <algorithm>
+
+namespace coma {
+namespace numb {
+
+namespace{
+using Array = tech::RuntimeArray<unsigned char>;
+
+/**
+ * @brief
+ * 	Counts significant bits of number.
+ *
+ * @param number
+ * 	Number stored in array.
+ *
+ * @return
+ * 	Position of the highest set bit increased by one, 0 for zero.
+ */
+unsigned long long bitLength(const Array &number) noexcept{
+	unsigned long long i { number.length() };
+	while(i > 0 && !number[i - 1]) --i;
+	if(!i) return 0;
+	unsigned long long length { 8 * (i - 1) };
+	for(unsigned char byte = number[i - 1]; byte; byte >>= 1) ++length;
+	return length;
+}
+
+/**
+ * @brief
+ * 	Checks if bit at given position is set.
+ *
+ * @param number
+ * 	Number stored in array.
+ *
+ * @param position
+ * 	Position of bit, 0 for the least significant one.
+ *
+ * @return
+ * 	True if bit is set. Else returns false.
+ */
+bool isBitSet(const Array &number, unsigned long long position) noexcept{
+	return position / 8 < number.length() && ((number[position / 8] >> (position % 8)) & 1);
+}
+
+/**
+ * @brief
+ * 	Checks if any bit below given position is set.
+ *
+ * @param number
+ * 	Number stored in array.
+ *
+ * @param position
+ * 	Position of the first bit which is not checked.
+ *
+ * @return
+ * 	True if @a number mod 2^@a position is not zero. Else returns false.
+ */
+bool isAnyBitSetBelow(const Array &number, unsigned long long position) noexcept{
+	for(unsigned long long i = 0; i < position / 8 && i < number.length(); ++i){
+		if(number[i]) return true;
+	}
+	return position / 8 < number.length() && (number[position / 8] & ((1u << (position % 8)) - 1));
+}
+
+/**
+ * @brief
+ * 	Copies number to array of different length. Missing bytes are filled with zeroes.
+ *
+ * @param number
+ * 	Number stored in array.
+ *
+ * @param length
+ * 	Length of result.
+ *
+ * @return
+ * 	@a number mod 256^@a length.
+ */
+Array resized(const Array &number, unsigned long long length){
+	Array result(length);
+	for(unsigned long long i = 0; i < length && i < number.length(); ++i) result[i] = number[i];
+	return result;
+}
+
+/**
+ * @brief
+ * 	Shifts number left without losing any bits.
+ *
+ * @param number
+ * 	Number stored in array.
+ *
+ * @param bits
+ * 	Number of bits to shift.
+ *
+ * @return
+ * 	@a number * 2^@a bits.
+ */
+Array shiftedLeft(const Array &number, unsigned long long bits){
+	Array result = resized(number, number.length() + bits / 8 + 1);
+	util::shiftBitsLeft(result, bits);
+	return result;
+}
+
+/**
+ * @brief
+ * 	Divides magnitudes keeping enough bits of quotient for correct rounding.
+ *
+ * @param dividend
+ * 	Dividend stored in array.
+ *
+ * @param divisor
+ * 	Non-zero divisor stored in array.
+ *
+ * @param precision
+ * 	Precision to which quotient is going to be rounded.
+ *
+ * @param exponent
+ * 	Exponent of quotient. It is decreased by number of bits by which dividend was shifted.
+ *
+ * @param inexact
+ * 	Set to true if division left non-zero remainder.
+ *
+ * @return
+ * 	Quotient having at least @a precision + 2 significant bits or zero.
+ */
+Array divide(const Array &dividend, const Array &divisor, unsigned long long precision,
+		long long &exponent, bool &inexact){
+	using namespace util;
+	inexact = false;
+	unsigned long long dividendLength { bitLength(dividend) }, divisorLength { bitLength(divisor) };
+	if(!dividendLength) return Array(1);
+	unsigned long long shift { 0 };
+	if(precision + 2 + divisorLength > dividendLength) shift = precision + 2 + divisorLength - dividendLength;
+	Array quotient = shiftedLeft(dividend, shift);
+	exponent -= static_cast<long long>(shift);
+	Array shiftedDividend = quotient;
+	quotient /= divisor;
+	Array product = resized(quotient, quotient.length() + divisor.length());
+	product *= divisor;
+	inexact = compare(product, shiftedDividend) != 0;
+	return quotient;
+}
+
+}
+
+//======================================
+//-------------BINARYFLOAT--------------
+//======================================
+
+BinaryFloat::BinaryFloat(const Array &magnitude,
+		long long exponent,
+		bool negative,
+		unsigned long long precision,
+		RoundingMode roundingMode,
+		bool inexact) :
+			m_mantissa(magnitude),
+			m_exponent{exponent},
+			m_negative{negative},
+			m_precision{precision},
+			m_roundingMode{roundingMode}{
+	if(!m_precision){
+		REPORT_CONSTRUCTOR_ERROR(std::exception("Precision must be positive"),
+				m_precision = 1; m_mantissa = Array(1); m_exponent = 0; m_negative = false);
+	}
+	if(!round(m_mantissa, m_exponent, m_negative, m_precision, m_roundingMode, inexact)) m_negative = false;
+}
+
+Pointer<BinaryFloat> BinaryFloat::fromInteger(Pointer<Integer> integer,
+		unsigned long long precision,
+		RoundingMode roundingMode){
+	if(!integer) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return std::make_shared<const BinaryFloat>(getMagnitude(*integer), 0, integer->isNegative(), precision, roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::fromFloatingPoint(Pointer<FloatingPoint> floatingPoint,
+		unsigned long long precision,
+		RoundingMode roundingMode){
+	if(!floatingPoint) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	long long exponent { 8 * floatingPoint->getPower()->getAsLongLong() };
+	bool inexact { false };
+	Array magnitude = divide(getMagnitude(*floatingPoint->getNumerator()),
+			getMagnitude(*floatingPoint->getDenominator()),
+			precision, exponent, inexact);
+	return std::make_shared<const BinaryFloat>(magnitude, exponent, floatingPoint->isNegative(),
+			precision, roundingMode, inexact);
+}
+
+Pointer<BinaryFloat> BinaryFloat::fromNumber(Pointer<Number> number,
+		unsigned long long precision,
+		RoundingMode roundingMode){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return fromFloatingPoint(number->getAsFloatingPoint(), precision, roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::fromPowerOfTwo(long long exponent,
+		unsigned long long precision,
+		RoundingMode roundingMode){
+	return std::make_shared<const BinaryFloat>(Array(1, 1), exponent, false, precision, roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::withPrecision(unsigned long long precision, RoundingMode roundingMode) const{
+	return std::make_shared<const BinaryFloat>(m_mantissa, m_exponent, m_negative, precision, roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::withPrecision(unsigned long long precision) const{
+	return withPrecision(precision, m_roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::getScaled(long long exponent) const{
+	return std::make_shared<const BinaryFloat>(m_mantissa, m_exponent + exponent, m_negative,
+			m_precision, m_roundingMode);
+}
+
+unsigned long long BinaryFloat::getPrecision() const noexcept{
+	return m_precision;
+}
+
+RoundingMode BinaryFloat::getRoundingMode() const noexcept{
+	return m_roundingMode;
+}
+
+long long BinaryFloat::getMagnitudeExponent() const noexcept{
+	if(isZero()) return 0;
+	return m_exponent + static_cast<long long>(m_precision);
+}
+
+bool BinaryFloat::isZero() const noexcept{
+	return !isBitSet(m_mantissa, m_precision - 1);
+}
+
+bool BinaryFloat::isNegative() const noexcept{
+	return m_negative;
+}
+
+bool BinaryFloat::isPositive() const noexcept{
+	return !m_negative && !isZero();
+}
+
+Pointer<BinaryFloat> BinaryFloat::getAbsoluteValue() const{
+	if(m_negative) return getNegation();
+	return shared_from_this();
+}
+
+Pointer<FloatingPoint> BinaryFloat::getAsFloatingPoint() const{
+	long long power { m_exponent / 8 };
+	if(m_exponent % 8 < 0) --power;
+	Array magnitude = shiftedLeft(m_mantissa, static_cast<unsigned long long>(m_exponent - 8 * power));
+	Pointer<Integer> numerator = Unsigned::fromLittleEndianArray(magnitude);
+	if(m_negative) numerator = staticPointerCast<Integer>(numerator->getNegation());
+	Pointer<Integer> exponent = Unsigned::fromUnsignedLongLong(
+			power < 0 ? 0ULL - static_cast<unsigned long long>(power) : static_cast<unsigned long long>(power));
+	if(power < 0) exponent = staticPointerCast<Integer>(exponent->getNegation());
+	return FloatingPoint::fromFraction(numerator, Number::ONE(), exponent);
+}
+
+Pointer<Integer> BinaryFloat::getAsInteger() const{
+	Array magnitude(1);
+	if(m_exponent >= 0){
+		magnitude = shiftedLeft(m_mantissa, static_cast<unsigned long long>(m_exponent));
+	}else if(static_cast<unsigned long long>(-m_exponent) < m_precision){
+		magnitude = m_mantissa;
+		util::shiftBitsRight(magnitude, static_cast<unsigned long long>(-m_exponent));
+	}
+	Pointer<Integer> result = Unsigned::fromLittleEndianArray(magnitude);
+	if(m_negative && !result->isZero()) result = staticPointerCast<Integer>(result->getNegation());
+	return result;
+}
+
+std::string BinaryFloat::getAsDecimal() const{
+	std::string result { m_negative ? "-" : "" };
+	result += Unsigned::fromLittleEndianArray(m_mantissa)->getAsDecimal();
+	result += " * 2^" + std::to_string(isZero() ? 0 : m_exponent);
+	return result;
+}
+
+//======================================
+//--------------COPYABLE----------------
+//======================================
+
+Pointer<BinaryFloat> BinaryFloat::copy() const{
+	return shared_from_this();
+}
+
+//======================================
+//-------------COMPARABLE---------------
+//======================================
+
+core::CompareResult BinaryFloat::compare(Pointer<BinaryFloat> toCompare) const{
+	using core::CompareResult;
+	if(!toCompare) REPORT_ERROR(std::exception("Null pointer exception"), CompareResult::Equal);
+	int thisSign { isZero() ? 0 : (m_negative ? -1 : 1) },
+		otherSign { toCompare->isZero() ? 0 : (toCompare->m_negative ? -1 : 1) };
+	if(thisSign != otherSign) return thisSign > otherSign ? CompareResult::ThisGreater : CompareResult::ThisLesser;
+	if(!thisSign) return CompareResult::Equal;
+	CompareResult result { CompareResult::Equal };
+	long long thisMagnitude { getMagnitudeExponent() }, otherMagnitude { toCompare->getMagnitudeExponent() };
+	if(thisMagnitude != otherMagnitude){
+		result = thisMagnitude > otherMagnitude ? CompareResult::ThisGreater : CompareResult::ThisLesser;
+	}else{
+		Array thisMantissa = m_mantissa, otherMantissa = toCompare->m_mantissa;
+		if(m_precision < toCompare->m_precision) thisMantissa = shiftedLeft(thisMantissa, toCompare->m_precision - m_precision);
+		else otherMantissa = shiftedLeft(otherMantissa, m_precision - toCompare->m_precision);
+		int compared { util::compare(thisMantissa, otherMantissa) };
+		if(compared) result = compared > 0 ? CompareResult::ThisGreater : CompareResult::ThisLesser;
+	}
+	return m_negative ? core::invertComparison(result) : result;
+}
+
+//======================================
+//-------------ARITHMETIC---------------
+//======================================
+
+Pointer<BinaryFloat> BinaryFloat::getSum(Pointer<BinaryFloat> toAdd) const{
+	using namespace util;
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	unsigned long long precision { std::max(m_precision, toAdd->m_precision) };
+	if(toAdd->isZero()) return withPrecision(precision, m_roundingMode);
+	if(isZero()) return toAdd->withPrecision(precision, m_roundingMode);
+	const BinaryFloat
+		&bigger { (m_exponent >= toAdd->m_exponent) ? *this : *toAdd },
+		&smaller { (m_exponent >= toAdd->m_exponent) ? *toAdd : *this };
+	unsigned long long gap { static_cast<unsigned long long>(bigger.m_exponent - smaller.m_exponent) };
+	bool subtract { bigger.m_negative != smaller.m_negative };
+	if(gap >= smaller.m_precision + precision + 3){
+		//smaller operand is below the rounding position, so it only decides direction of rounding
+		Array magnitude = shiftedLeft(bigger.m_mantissa, precision + 3);
+		if(subtract) magnitude -= Array(1, 1);
+		return std::make_shared<const BinaryFloat>(magnitude,
+				bigger.m_exponent - static_cast<long long>(precision + 3),
+				bigger.m_negative, precision, m_roundingMode, true);
+	}
+	Array magnitude = shiftedLeft(bigger.m_mantissa, gap);
+	unsigned long long length { std::max(magnitude.length(), smaller.m_mantissa.length()) + 1 };
+	magnitude = resized(magnitude, length);
+	Array other = resized(smaller.m_mantissa, length);
+	bool negative { bigger.m_negative };
+	if(!subtract){
+		magnitude += other;
+	}else if(util::compare(magnitude, other) >= 0){
+		magnitude -= other;
+	}else{
+		other -= magnitude;
+		magnitude = other;
+		negative = !negative;
+	}
+	return std::make_shared<const BinaryFloat>(magnitude, smaller.m_exponent, negative, precision, m_roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::getDifference(Pointer<BinaryFloat> toSubtract) const{
+	if(!toSubtract) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return getSum(toSubtract->getNegation());
+}
+
+Pointer<BinaryFloat> BinaryFloat::getNegation() const{
+	return std::make_shared<const BinaryFloat>(m_mantissa, m_exponent, !m_negative, m_precision, m_roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::getProduct(Pointer<BinaryFloat> toMultiply) const{
+	using namespace util;
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	unsigned long long precision { std::max(m_precision, toMultiply->m_precision) };
+	Array magnitude = resized(m_mantissa, m_mantissa.length() + toMultiply->m_mantissa.length());
+	if(toMultiply.get() == this) square(magnitude);
+	else magnitude *= toMultiply->m_mantissa;
+	return std::make_shared<const BinaryFloat>(magnitude, m_exponent + toMultiply->m_exponent,
+			m_negative != toMultiply->m_negative, precision, m_roundingMode);
+}
+
+Pointer<BinaryFloat> BinaryFloat::getQuotient(Pointer<BinaryFloat> toDivide) const{
+	if(!toDivide) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(toDivide->isZero()) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
+	unsigned long long precision { std::max(m_precision, toDivide->m_precision) };
+	long long exponent { m_exponent - toDivide->m_exponent };
+	bool inexact { false };
+	Array magnitude = divide(m_mantissa, toDivide->m_mantissa, precision, exponent, inexact);
+	return std::make_shared<const BinaryFloat>(magnitude, exponent, m_negative != toDivide->m_negative,
+			precision, m_roundingMode, inexact);
+}
+
+Pointer<BinaryFloat> BinaryFloat::getInversion() const{
+	return fromPowerOfTwo(0, m_precision, m_roundingMode)->getQuotient(shared_from_this());
+}
+
+Array BinaryFloat::getMagnitude(const Integer &number){
+	return number.getArray();
+}
+
+bool BinaryFloat::round(Array &magnitude,
+		long long &exponent,
+		bool negative,
+		unsigned long long precision,
+		RoundingMode roundingMode,
+		bool inexact){
+	unsigned long long length { bitLength(magnitude) }, bytes { (precision + 7) / 8 };
+	if(!length){
+		magnitude = Array(bytes);
+		exponent = 0;
+		return false;
+	}
+	if(length <= precision){
+		magnitude = resized(shiftedLeft(magnitude, precision - length), bytes);
+		exponent -= static_cast<long long>(precision - length);
+		return true;
+	}
+	unsigned long long dropped { length - precision };
+	bool half { isBitSet(magnitude, dropped - 1) },
+		rest { inexact || isAnyBitSetBelow(magnitude, dropped - 1) };
+	util::shiftBitsRight(magnitude, dropped);
+	magnitude = resized(magnitude, bytes + 1);
+	exponent += static_cast<long long>(dropped);
+	bool increment { false };
+	switch(roundingMode){
+	case RoundingMode::ToNearestEven:
+		increment = half && (rest || isBitSet(magnitude, 0));
+		break;
+	case RoundingMode::TowardZero:
+		increment = false;
+		break;
+	case RoundingMode::TowardPositive:
+		increment = !negative && (half || rest);
+		break;
+	case RoundingMode::TowardNegative:
+		increment = negative && (half || rest);
+		break;
+	}
+	if(increment){
+		for(unsigned long long i = 0; i < magnitude.length() && !++magnitude[i]; ++i);
+		if(isBitSet(magnitude, precision)){
+			util::shiftBitsRight(magnitude, 1);
+			++exponent;
+		}
+	}
+	magnitude = resized(magnitude, bytes);
+	return true;
+}
+
+} /* namespace numb */
+} /* namespace coma */
@@ -0,0 +1,427 @@
+/*
+ * BinaryFloat.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_BINARYFLOAT_H_
+#define NUMBERS_BINARYFLOAT_H_
+
+#include <string>
+#include <memory>
+
+#include "../coreInterfaces/Arithmetic.h"
+#include "../coreInterfaces/Comparable.h"
+#include "../coreInterfaces/Copyable.h"
+#include "../Technical/MemoryPoolObject.h"
+#include "../Technical/RuntimeArray.h"
+#include "../defines.h"
+#include "typedefs.h"
+
+namespace coma {
+namespace numb {
+
+class Number;
+class Integer;
+class FloatingPoint;
+
+/**
+ * @brief
+ * 	Enum defining how results which are not representable in given precision are rounded.
+ */
+enum class RoundingMode{
+	ToNearestEven, //!< ToNearestEven round to nearest representable value, ties to the one with even mantissa
+	TowardZero,    //!< TowardZero round towards zero (truncate)
+	TowardPositive,//!< TowardPositive round towards positive infinity
+	TowardNegative //!< TowardNegative round towards negative infinity
+};
+
+/**
+ * @brief
+ * 	Concrete class representing binary floating point number of fixed precision.
+ *
+ * @details
+ * 	The value is stored as mantissa * 2^exponent, where mantissa has exactly precision significant bits. Every
+ * 	operation is computed as if with infinite precision and then rounded once to the precision of result
+ * 	according to rounding mode, so results are correctly rounded and the cost of each operation is bounded
+ * 	by the precision instead of growing with every operation like in case of FloatingPoint.
+ *
+ * 	Result of operation on two numbers has the bigger of their precisions and rounding mode of @c *this.
+ */
+class BinaryFloat final:
+		public core::Arithmetic<Pointer<BinaryFloat>>,
+		public core::Comparable<Pointer<BinaryFloat>>,
+		public core::Copyable<Pointer<BinaryFloat>>,
+		public tech::MemoryPoolObject,
+		public std::enable_shared_from_this<BinaryFloat>{
+public:
+	//======================================
+	//-------------BINARYFLOAT--------------
+	//======================================
+
+	/**
+	 * @brief
+	 * 	Creates BinaryFloat closest to given Integer in sense of rounding mode.
+	 *
+	 * @param integer
+	 * 	Integer to convert.
+	 *
+	 * @param precision
+	 * 	Number of bits of mantissa.
+	 *
+	 * @param roundingMode
+	 * 	Rounding mode of created number.
+	 *
+	 * @return
+	 * 	New BinaryFloat with value of @a integer rounded to @a precision bits.
+	 */
+	static Pointer<BinaryFloat> fromInteger(Pointer<Integer> integer,
+			unsigned long long precision,
+			RoundingMode roundingMode = RoundingMode::ToNearestEven);
+
+	/**
+	 * @brief
+	 * 	Creates BinaryFloat closest to given FloatingPoint in sense of rounding mode.
+	 *
+	 * @param floatingPoint
+	 * 	Number to convert.
+	 *
+	 * @param precision
+	 * 	Number of bits of mantissa.
+	 *
+	 * @param roundingMode
+	 * 	Rounding mode of created number.
+	 *
+	 * @return
+	 * 	New BinaryFloat with value of @a floatingPoint rounded to @a precision bits.
+	 */
+	static Pointer<BinaryFloat> fromFloatingPoint(Pointer<FloatingPoint> floatingPoint,
+			unsigned long long precision,
+			RoundingMode roundingMode = RoundingMode::ToNearestEven);
+
+	/**
+	 * @brief
+	 * 	Creates BinaryFloat closest to real part of given Number in sense of rounding mode.
+	 *
+	 * @param number
+	 * 	Number to convert.
+	 *
+	 * @param precision
+	 * 	Number of bits of mantissa.
+	 *
+	 * @param roundingMode
+	 * 	Rounding mode of created number.
+	 *
+	 * @return
+	 * 	New BinaryFloat with value of @a number rounded to @a precision bits.
+	 */
+	static Pointer<BinaryFloat> fromNumber(Pointer<Number> number,
+			unsigned long long precision,
+			RoundingMode roundingMode = RoundingMode::ToNearestEven);
+
+	/**
+	 * @brief
+	 * 	Creates BinaryFloat equal to 2^@a exponent.
+	 *
+	 * @param exponent
+	 * 	Exponent of created power of two.
+	 *
+	 * @param precision
+	 * 	Number of bits of mantissa.
+	 *
+	 * @param roundingMode
+	 * 	Rounding mode of created number.
+	 *
+	 * @return
+	 * 	New BinaryFloat equal to 2^@a exponent.
+	 */
+	static Pointer<BinaryFloat> fromPowerOfTwo(long long exponent,
+			unsigned long long precision,
+			RoundingMode roundingMode = RoundingMode::ToNearestEven);
+
+	/**
+	 * @brief
+	 * 	Creates BinaryFloat from magnitude and exponent and rounds it to given precision.
+	 *
+	 * @details
+	 * 	Constructor should NOT be used directly. Use static factories instead.
+	 *
+	 * 	Value of created number is (-1)^@a negative * (@a magnitude + f) * 2^@a exponent, where f = 0 when
+	 * 	@a inexact is false and 0 < f < 1 otherwise. When @a inexact is true @a magnitude must have at least
+	 * 	@a precision + 2 significant bits.
+	 *
+	 * @param magnitude
+	 * 	Absolute value of mantissa stored in little-endian manner.
+	 *
+	 * @param exponent
+	 * 	Power of two by which @a magnitude is multiplied.
+	 *
+	 * @param negative
+	 * 	Tells if number is negative.
+	 *
+	 * @param precision
+	 * 	Number of bits of mantissa, at least 1.
+	 *
+	 * @param roundingMode
+	 * 	Rounding mode used to round given value and results of further operations.
+	 *
+	 * @param inexact
+	 * 	Tells if there are non-zero bits below least significant bit of @a magnitude.
+	 */
+	BinaryFloat(const tech::RuntimeArray<unsigned char> &magnitude,
+			long long exponent,
+			bool negative,
+			unsigned long long precision,
+			RoundingMode roundingMode,
+			bool inexact = false);
+
+	/**
+	 * @brief
+	 * 	Default virtual destructor.
+	 */
+	virtual ~BinaryFloat() noexcept = default;
+
+	/**
+	 * @brief
+	 * 	Rounds @c *this to different precision.
+	 *
+	 * @param precision
+	 * 	Number of bits of mantissa of result.
+	 *
+	 * @param roundingMode
+	 * 	Rounding mode of result.
+	 *
+	 * @return
+	 * 	@c *this rounded to @a precision bits.
+	 */
+	Pointer<BinaryFloat> withPrecision(unsigned long long precision, RoundingMode roundingMode) const;
+
+	/**
+	 * @brief
+	 * 	Rounds @c *this to different precision keeping rounding mode.
+	 *
+	 * @param precision
+	 * 	Number of bits of mantissa of result.
+	 *
+	 * @return
+	 * 	@c *this rounded to @a precision bits.
+	 */
+	Pointer<BinaryFloat> withPrecision(unsigned long long precision) const;
+
+	/**
+	 * @brief
+	 * 	Multiplies @c *this by power of two. The operation is exact.
+	 *
+	 * @param exponent
+	 * 	Power of two.
+	 *
+	 * @return
+	 * 	@c *this * 2^@a exponent.
+	 */
+	Pointer<BinaryFloat> getScaled(long long exponent) const;
+
+	/**
+	 * @brief
+	 * 	Precision getter.
+	 *
+	 * @return
+	 * 	Number of bits of mantissa.
+	 */
+	unsigned long long getPrecision() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Rounding mode getter.
+	 *
+	 * @return
+	 * 	Rounding mode used for results of operations.
+	 */
+	RoundingMode getRoundingMode() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Gets exponent of the most significant bit.
+	 *
+	 * @details
+	 * 	For non-zero number 2^(e-1) <= |@c *this| < 2^e. For zero 0 is returned.
+	 *
+	 * @return
+	 * 	Value of e from formula above.
+	 */
+	long long getMagnitudeExponent() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Checks if stored value is equal to zero.
+	 *
+	 * @return
+	 * 	True if stored value equals 0. Else returns false.
+	 */
+	bool isZero() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Checks if stored value is negative.
+	 *
+	 * @return
+	 * 	True if stored value is lesser than 0. Else returns false.
+	 */
+	bool isNegative() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Checks if stored value is positive.
+	 *
+	 * @return
+	 * 	True if stored value is greater than 0. Else returns false.
+	 */
+	bool isPositive() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Gets absolute value of @c *this.
+	 *
+	 * @return
+	 * 	Absolute value of @c *this.
+	 */
+	Pointer<BinaryFloat> getAbsoluteValue() const;
+
+	/**
+	 * @brief
+	 * 	Converts @c *this to FloatingPoint. The conversion is exact.
+	 *
+	 * @return
+	 * 	FloatingPoint equal to @c *this.
+	 */
+	Pointer<FloatingPoint> getAsFloatingPoint() const;
+
+	/**
+	 * @brief
+	 * 	Converts @c *this to Integer rounding towards zero.
+	 *
+	 * @return
+	 * 	Integer part of @c *this.
+	 */
+	Pointer<Integer> getAsInteger() const;
+
+	/**
+	 * @brief
+	 * 	Method used to get stored value.
+	 *
+	 * @return
+	 * 	Stored value in form "mantissa * 2^exponent" with both numbers written in decimal.
+	 */
+	std::string getAsDecimal() const;
+
+	//======================================
+	//--------------COPYABLE----------------
+	//======================================
+
+	virtual Pointer<BinaryFloat> copy() const override;
+
+	//======================================
+	//-------------COMPARABLE---------------
+	//======================================
+
+	virtual core::CompareResult compare(Pointer<BinaryFloat> toCompare) const override;
+
+	//======================================
+	//-------------ARITHMETIC---------------
+	//======================================
+
+	/**
+	 * @{
+	 */
+
+	virtual Pointer<BinaryFloat> getSum(Pointer<BinaryFloat> toAdd) const override;
+	virtual Pointer<BinaryFloat> getDifference(Pointer<BinaryFloat> toSubtract) const override;
+	virtual Pointer<BinaryFloat> getNegation() const override;
+	virtual Pointer<BinaryFloat> getProduct(Pointer<BinaryFloat> toMultiply) const override;
+	virtual Pointer<BinaryFloat> getQuotient(Pointer<BinaryFloat> toDivide) const override;
+	virtual Pointer<BinaryFloat> getInversion() const override;
+
+	/**
+	 * @}
+	 */
+
+private:
+	/**
+	 * @brief
+	 * 	Gets absolute value of given Integer.
+	 *
+	 * @param number
+	 * 	Integer which absolute value is taken.
+	 *
+	 * @return
+	 * 	Array containing absolute value of @a number.
+	 */
+	static tech::RuntimeArray<unsigned char> getMagnitude(const Integer &number);
+
+	/**
+	 * @brief
+	 * 	Rounds @a magnitude to @a precision bits.
+	 *
+	 * @param magnitude
+	 * 	Mantissa to round. It is replaced by rounded mantissa occupying exactly @a precision bits.
+	 *
+	 * @param exponent
+	 * 	Exponent of @a magnitude. It is adjusted to exponent of rounded mantissa.
+	 *
+	 * @param negative
+	 * 	Sign of the number, used by directed rounding modes.
+	 *
+	 * @param precision
+	 * 	Number of bits of result.
+	 *
+	 * @param roundingMode
+	 * 	Rounding mode.
+	 *
+	 * @param inexact
+	 * 	Tells if there are non-zero bits below least significant bit of @a magnitude.
+	 *
+	 * @return
+	 * 	False if @a magnitude is zero. Else returns true.
+	 */
+	static bool round(tech::RuntimeArray<unsigned char> &magnitude,
+			long long &exponent,
+			bool negative,
+			unsigned long long precision,
+			RoundingMode roundingMode,
+			bool inexact);
+
+	/**
+	 * @brief
+	 * 	Absolute value of mantissa, exactly m_precision bits long, or zero.
+	 */
+	tech::RuntimeArray<unsigned char> m_mantissa;
+
+	/**
+	 * @brief
+	 * 	Power of two by which mantissa is multiplied.
+	 */
+	long long m_exponent;
+
+	/**
+	 * @brief
+	 * 	Sign of the number.
+	 */
+	bool m_negative;
+
+	/**
+	 * @brief
+	 * 	Number of bits of mantissa.
+	 */
+	unsigned long long m_precision;
+
+	/**
+	 * @brief
+	 * 	Rounding mode used for results of operations.
+	 */
+	RoundingMode m_roundingMode;
+};
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_BINARYFLOAT_H_ */
@@ -0,0 +1,100 @@
+/*
+ * BinarySplitting.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "BinarySplitting.h"
+#include "Unsigned.h"
+
+#include "../Technical/Concurrency.h"
+#include "../Technical/TaskGroup.h"
+
+namespace coma {
+namespace numb {
+
+namespace{
+
+/**
+ * @brief
+ * 	Minimal number of terms in range for which halves are evaluated in separate threads.
+ */
+const unsigned long long PARALLEL_THRESHOLD { 64 };
+
+/**
+ * @brief
+ * 	Multiplies two Integers.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor.
+ *
+ * @return
+ * 	@a lhs * @a rhs.
+ */
+Pointer<Integer> multiply(Pointer<Integer> lhs, Pointer<Integer> rhs){
+	return staticPointerCast<Integer>(lhs->getProduct(rhs));
+}
+
+}
+
+BinarySplitting::BinarySplitting(Term a, Term b, Term p, Term q) :
+		m_a{a},
+		m_b{b},
+		m_p{p},
+		m_q{q}{
+	if(!m_a || !m_p || !m_q){
+		REPORT_CONSTRUCTOR_ERROR(std::exception("Null pointer exception"), m_a = m_p = m_q =
+				[](unsigned long long){ return Pointer<Integer>(Number::ONE()); });
+	}
+}
+
+BinarySplitting::Range BinarySplitting::getRange(unsigned long long begin, unsigned long long end) const{
+	if(begin >= end) REPORT_ERROR(std::exception("Empty range exception"), Range());
+	return split(begin, end, tech::getParallelDepth(2));
+}
+
+Pointer<BinaryFloat> BinarySplitting::getSum(unsigned long long begin, unsigned long long end,
+		unsigned long long precision) const{
+	Range range = getRange(begin, end);
+	if(!range.t) return nullptr;
+	Pointer<BinaryFloat> denominator = BinaryFloat::fromInteger(multiply(range.b, range.q), precision + 2);
+	return BinaryFloat::fromInteger(range.t, precision + 2)->getQuotient(denominator)->withPrecision(precision);
+}
+
+BinarySplitting::Range BinarySplitting::split(unsigned long long begin, unsigned long long end, unsigned depth) const{
+	if(end - begin == 1){
+		Range leaf;
+		leaf.p = m_p(begin);
+		leaf.q = m_q(begin);
+		leaf.b = m_b ? m_b(begin) : Pointer<Integer>(Number::ONE());
+		leaf.t = multiply(m_a(begin), leaf.p);
+		return leaf;
+	}
+	unsigned long long middle { begin + (end - begin) / 2 };
+	Range left, right;
+	if(depth && end - begin >= PARALLEL_THRESHOLD){
+		tech::TaskGroup group;
+		group.fork([&](){ left = split(begin, middle, depth - 1); });
+		right = split(middle, end, depth - 1);
+		group.join();
+	}else{
+		left = split(begin, middle, 0);
+		right = split(middle, end, 0);
+	}
+	Range merged;
+	merged.p = multiply(left.p, right.p);
+	merged.q = multiply(left.q, right.q);
+	merged.b = multiply(left.b, right.b);
+	Pointer<Integer>
+		first = multiply(multiply(right.b, right.q), left.t),
+		second = multiply(multiply(left.b, left.p), right.t);
+	merged.t = staticPointerCast<Integer>(first->getSum(second));
+	return merged;
+}
+
+} /* namespace numb */
+} /* namespace coma */
@@ -0,0 +1,169 @@
+/*
+ * BinarySplitting.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_BINARYSPLITTING_H_
+#define NUMBERS_BINARYSPLITTING_H_
+
+#include <functional>
+
+#include "Integer.h"
+#include "BinaryFloat.h"
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Evaluates sums of hypergeometric-like series with binary splitting.
+ *
+ * @details
+ * 	Series has form:
+ * 		S(n1, n2) = sum for n in [n1, n2) of a(n)/b(n) * p(n1)...p(n) / (q(n1)...q(n)),
+ * 	where a, b, p and q are Integer valued functions. Range of terms is split in halves recursively and partial
+ * 	results are merged with exact Integer arithmetic, so the whole sum is built from a balanced tree of products
+ * 	of numbers of similar size. Independent halves on the upper levels of the tree are evaluated in parallel.
+ */
+class BinarySplitting {
+public:
+	/**
+	 * @brief
+	 * 	Function giving value of one of series' factors for term of given index.
+	 */
+	using Term = std::function<Pointer<Integer>(unsigned long long)>;
+
+	/**
+	 * @brief
+	 * 	Exact result of evaluation of range [n1, n2) of terms.
+	 *
+	 * @details
+	 * 	S(n1, n2) = t / (b * q).
+	 */
+	struct Range{
+		/**
+		 * @brief
+		 * 	p(n1)...p(n2 - 1).
+		 */
+		Pointer<Integer> p;
+
+		/**
+		 * @brief
+		 * 	q(n1)...q(n2 - 1).
+		 */
+		Pointer<Integer> q;
+
+		/**
+		 * @brief
+		 * 	b(n1)...b(n2 - 1).
+		 */
+		Pointer<Integer> b;
+
+		/**
+		 * @brief
+		 * 	Numerator of the sum, equal to b * q * S(n1, n2).
+		 */
+		Pointer<Integer> t;
+	};
+
+	/**
+	 * @brief
+	 * 	Creates evaluator of series with given factors.
+	 *
+	 * @param a
+	 * 	Numerator of the free factor of term.
+	 *
+	 * @param b
+	 * 	Denominator of the free factor of term. Empty function is treated as constant 1.
+	 *
+	 * @param p
+	 * 	Numerator of ratio of consecutive terms.
+	 *
+	 * @param q
+	 * 	Denominator of ratio of consecutive terms.
+	 */
+	BinarySplitting(Term a, Term b, Term p, Term q);
+
+	/**
+	 * @brief
+	 * 	Evaluates range of terms exactly.
+	 *
+	 * @param begin
+	 * 	Index of the first term.
+	 *
+	 * @param end
+	 * 	Index after the last term, greater than @a begin.
+	 *
+	 * @return
+	 * 	Products and numerator of the sum of terms from [@a begin, @a end).
+	 */
+	Range getRange(unsigned long long begin, unsigned long long end) const;
+
+	/**
+	 * @brief
+	 * 	Evaluates sum of range of terms.
+	 *
+	 * @param begin
+	 * 	Index of the first term.
+	 *
+	 * @param end
+	 * 	Index after the last term, greater than @a begin.
+	 *
+	 * @param precision
+	 * 	Precision of result.
+	 *
+	 * @return
+	 * 	S(@a begin, @a end) with relative error of at most two units in last place.
+	 */
+	Pointer<BinaryFloat> getSum(unsigned long long begin, unsigned long long end, unsigned long long precision) const;
+
+private:
+	/**
+	 * @brief
+	 * 	Evaluates range of terms splitting it recursively.
+	 *
+	 * @param begin
+	 * 	Index of the first term.
+	 *
+	 * @param end
+	 * 	Index after the last term.
+	 *
+	 * @param depth
+	 * 	Number of levels of the tree on which halves are still evaluated in parallel.
+	 *
+	 * @return
+	 * 	Products and numerator of the sum of terms from [@a begin, @a end).
+	 */
+	Range split(unsigned long long begin, unsigned long long end, unsigned depth) const;
+
+	/**
+	 * @brief
+	 * 	Numerator of the free factor of term.
+	 */
+	Term m_a;
+
+	/**
+	 * @brief
+	 * 	Denominator of the free factor of term, may be empty.
+	 */
+	Term m_b;
+
+	/**
+	 * @brief
+	 * 	Numerator of ratio of consecutive terms.
+	 */
+	Term m_p;
+
+	/**
+	 * @brief
+	 * 	Denominator of ratio of consecutive terms.
+	 */
+	Term m_q;
+};
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_BINARYSPLITTING_H_ */
@@ -1,210 +1,282 @@
-/*
- * Complex.cpp
- *
- *  Created on: 27 cze 2015
- *      Author: Bartosz Miera
- */
-
-#include <memory>
-#include <algorithm>
-#include "Complex.h"
-#include "FloatingPoint.h"
-#include "Signed.h"
-#include "Unsigned.h"
-
-namespace coma {
-namespace numb {
-
-using namespace std;
-
-//======================================
-//--------------COMPLEX-----------------
-//======================================
-
-Pointer<Complex> Complex::fromRealAndImaginary(const Pointer<RealNumber> real, const Pointer<RealNumber> imaginary){
-	if(!real || !imaginary) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return std::make_shared<const Complex>(real, imaginary);
-}
-
-Pointer<Complex> Complex::fromBinaryInString(const String &complex){
-	auto plusSign = complex.find(" + ");
-	String re = complex.substr(0, plusSign),
-			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
-	return std::make_shared<const Complex>(RealNumber::fromBinaryInString(re),
-			RealNumber::fromBinaryInString(im));
-}
-
-Pointer<Complex> Complex::fromOctalInString(const String &complex){
-	auto plusSign = complex.find(" + ");
-	String re = complex.substr(0, plusSign),
-			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
-	return std::make_shared<const Complex>(RealNumber::fromOctalInString(re),
-			RealNumber::fromOctalInString(im));
-}
-
-Pointer<Complex> Complex::fromDecimalInString(const String &complex){
-	auto plusSign = complex.find(" + ");
-	String re = complex.substr(0, plusSign),
-			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
-	return std::make_shared<const Complex>(RealNumber::fromDecimalInString(re),
-			RealNumber::fromDecimalInString(im));
-}
-
-Pointer<Complex> Complex::fromHexadecimalInString(const String &complex){
-	auto plusSign = complex.find(" + ");
-	String re = complex.substr(0, plusSign),
-			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
-	return std::make_shared<const Complex>(RealNumber::fromHexadecimalInString(re),
-			RealNumber::fromHexadecimalInString(im));
-}
-
-Complex::Complex(const Pointer<RealNumber> real, const Pointer<RealNumber> imaginary):
-	m_real{real},
-	m_imaginary{imaginary}{}
-
-Complex::~Complex() noexcept{
-}
-
-//======================================
-//--------------COPYABLE----------------
-//======================================
-
-Pointer<Number> Complex::copy() const{
-	return getAsComplex();
-}
-
-//======================================
-//-------------ARITHMETIC---------------
-//======================================
-
-Pointer<Number> Complex::getSum(Pointer<Number> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toAdd->getSum(sharedThis());
-}
-
-Pointer<Number> Complex::getSum(Pointer<Complex> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<RealNumber> real = staticPointerCast<RealNumber>(toAdd->m_real->getSum(m_real));
-	Pointer<RealNumber> im   = staticPointerCast<RealNumber>(toAdd->m_imaginary->getSum(m_imaginary));
-	return fromRealAndImaginary(real, im);
-}
-
-Pointer<Number> Complex::getSum(Pointer<FloatingPoint> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<Complex> left = toAdd->getAsComplex();
-	return left->getSum(sharedThis());
-}
-
-Pointer<Number> Complex::getSum(Pointer<Signed> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<Complex> left = toAdd->getAsComplex();
-	return left->getSum(sharedThis());
-}
-
-Pointer<Number> Complex::getSum(Pointer<Unsigned> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<Complex> left = toAdd->getAsComplex();
-	return left->getSum(sharedThis());
-}
-
-Pointer<Number> Complex::getProduct(Pointer<Number> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toMultiply->getProduct(sharedThis());
-}
-
-Pointer<Number> Complex::getProduct(Pointer<Complex> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<RealNumber>
-		re1 = staticPointerCast<RealNumber>(m_real->getProduct(toMultiply->m_real)),
-		re2 = staticPointerCast<RealNumber>(m_imaginary->getProduct(toMultiply->m_imaginary));
-	Pointer<RealNumber>
-		im1 = staticPointerCast<RealNumber>(m_real->getProduct(toMultiply->m_imaginary)),
-		im2 = staticPointerCast<RealNumber>(m_imaginary->getProduct(toMultiply->m_real));
-	re1 = staticPointerCast<RealNumber>(re1->getDifference(re2));
-	im1 = staticPointerCast<RealNumber>(im1->getSum(im2));
-	return fromRealAndImaginary(re1, im1);
-}
-
-Pointer<Number> Complex::getProduct(Pointer<FloatingPoint> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<Complex> left = toMultiply->getAsComplex();
-	return left->getProduct(sharedThis());
-}
-
-Pointer<Number> Complex::getProduct(Pointer<Signed> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<Complex> left = toMultiply->getAsComplex();
-	return left->getProduct(sharedThis());
-}
-
-Pointer<Number> Complex::getProduct(Pointer<Unsigned> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	Pointer<Complex> left = toMultiply->getAsComplex();
-	return toMultiply->getProduct(sharedThis());
-}
-
-//======================================
-//---------------NUMBER-----------------
-//======================================
-
-Pointer<Number> Complex::getAbsoluteValue() const{
-}
-
-bool Complex::isZero() const noexcept{
-	return m_real->isZero() && m_imaginary->isZero();
-}
-
-string Complex::getAsBinary() const{
-	return m_real->getAsBinary() + " + " + m_imaginary->getAsBinary() + " * i";
-}
-
-string Complex::getAsOctal() const{
-	return m_real->getAsOctal() + " + " + m_imaginary->getAsOctal() + " * i";
-}
-
-string Complex::getAsDecimal() const{
-	return m_real->getAsDecimal() + " + " + m_imaginary->getAsDecimal() + " * i";
-}
-
-string Complex::getAsHexadecimal() const{
-	return m_real->getAsHexadecimal() + " + " + m_imaginary->getAsHexadecimal() + " * i";
-}
-
-Pointer<Unsigned> Complex::getAsUnsignedInteger() const{
-	return m_real->getAsUnsignedInteger();
-}
-
-Pointer<Signed> Complex::getAsSignedInteger() const{
-	return m_real->getAsSignedInteger();
-}
-
-Pointer<FloatingPoint> Complex::getAsFloatingPoint() const{
-	return m_real->getAsFloatingPoint();
-}
-
-Pointer<Complex> Complex::getAsComplex() const{
-	return fromRealAndImaginary(m_real, m_imaginary);
-}
-
-Pointer<Number> Complex::getNegation() const{
-	Pointer<RealNumber> re = staticPointerCast<RealNumber>(m_real->getNegation()) ;
-	Pointer<RealNumber> im = staticPointerCast<RealNumber>(m_imaginary->getNegation());
-	return fromRealAndImaginary(re, im);
-}
-
-Pointer<Number> Complex::getInversion() const{
-	Pointer<RealNumber> re = staticPointerCast<RealNumber>(m_real->getProduct(m_real));
-	Pointer<RealNumber> im = staticPointerCast<RealNumber>(m_imaginary->getProduct(m_imaginary));
-	re = staticPointerCast<RealNumber>(re->getSum(im));
-	im = staticPointerCast<RealNumber>(m_imaginary->getQuotient(re));
-	re = staticPointerCast<RealNumber>(m_real->getQuotient(re));
-	im = staticPointerCast<RealNumber>(im->getNegation());
-	return fromRealAndImaginary(re, im);
-}
-
-Pointer<Complex> Complex::sharedThis() const{
-	return staticPointerCast<Complex>(shared_from_this());
-}
-
-} /* namespace numb */
-} /* namespace coma */
+/*
+ * Complex.cpp
+ *
+ *  Created on: 27 cze 2015
+ *      Author: Bartosz Miera
+ */
+
+#include <memory>
+#include <algorithm>
+#include "Complex.h"
+#include "FloatingPoint.h"
+#include "Signed.h"
+#include "Unsigned.h"
+
+namespace coma {
+namespace numb {
+
+using namespace std;
+
+namespace{
+
+/**
+ * @brief
+ * 	Minimal length in bits of Integer parts, for which product of Complex numbers uses three multiplications.
+ */
+const unsigned long long GAUSS_THRESHOLD { 1024 };
+
+/**
+ * @brief
+ * 	Checks if part of Complex number is Integer long enough to trade multiplication for additions.
+ *
+ * @param part
+ * 	Real or imaginary part.
+ *
+ * @return
+ * 	True if @a part is Integer of at least GAUSS_THRESHOLD bits. Else returns false.
+ */
+bool isLongInteger(const Pointer<RealNumber> &part){
+	return part->isInteger() && staticPointerCast<Integer>(part)->getBitLength() >= GAUSS_THRESHOLD;
+}
+
+/**
+ * @brief
+ * 	Multiplies two parts of Complex numbers.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor.
+ *
+ * @return
+ * 	@a lhs * @a rhs.
+ */
+Pointer<RealNumber> multiply(const Pointer<RealNumber> &lhs, const Pointer<Number> &rhs){
+	return staticPointerCast<RealNumber>(lhs->getProduct(rhs));
+}
+
+}
+
+//======================================
+//--------------COMPLEX-----------------
+//======================================
+
+Pointer<Complex> Complex::fromRealAndImaginary(const Pointer<RealNumber> real, const Pointer<RealNumber> imaginary){
+	if(!real || !imaginary) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return std::make_shared<const Complex>(real, imaginary);
+}
+
+Pointer<Complex> Complex::fromBinaryInString(const String &complex){
+	auto plusSign = complex.find(" + ");
+	String re = complex.substr(0, plusSign),
+			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
+	return std::make_shared<const Complex>(RealNumber::fromBinaryInString(re),
+			RealNumber::fromBinaryInString(im));
+}
+
+Pointer<Complex> Complex::fromOctalInString(const String &complex){
+	auto plusSign = complex.find(" + ");
+	String re = complex.substr(0, plusSign),
+			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
+	return std::make_shared<const Complex>(RealNumber::fromOctalInString(re),
+			RealNumber::fromOctalInString(im));
+}
+
+Pointer<Complex> Complex::fromDecimalInString(const String &complex){
+	auto plusSign = complex.find(" + ");
+	String re = complex.substr(0, plusSign),
+			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
+	return std::make_shared<const Complex>(RealNumber::fromDecimalInString(re),
+			RealNumber::fromDecimalInString(im));
+}
+
+Pointer<Complex> Complex::fromHexadecimalInString(const String &complex){
+	auto plusSign = complex.find(" + ");
+	String re = complex.substr(0, plusSign),
+			im = complex.substr(plusSign + 3, complex.length() - plusSign - 7);
+	return std::make_shared<const Complex>(RealNumber::fromHexadecimalInString(re),
+			RealNumber::fromHexadecimalInString(im));
+}
+
+Complex::Complex(const Pointer<RealNumber> real, const Pointer<RealNumber> imaginary):
+	m_real{real},
+	m_imaginary{imaginary}{}
+
+Complex::~Complex() noexcept{
+}
+
+Pointer<Complex> Complex::getSquare() const{
+	Pointer<RealNumber> re, im;
+	if(m_real->isInteger() && m_imaginary->isInteger()){
+		//(a + bi)^2 = (a + b)(a - b) + 2abi
+		re = multiply(staticPointerCast<RealNumber>(m_real->getSum(m_imaginary)), m_real->getDifference(m_imaginary));
+		im = staticPointerCast<Integer>(m_real->getProduct(m_imaginary))->getShiftedLeft(1);
+	}else{
+		//sums of fractions are expensive, so squares are used instead
+		re = staticPointerCast<RealNumber>(multiply(m_real, m_real)->getDifference(multiply(m_imaginary, m_imaginary)));
+		im = multiply(m_real, m_imaginary);
+		im = staticPointerCast<RealNumber>(im->getSum(im));
+	}
+	return fromRealAndImaginary(re, im);
+}
+
+//======================================
+//--------------COPYABLE----------------
+//======================================
+
+Pointer<Number> Complex::copy() const{
+	return getAsComplex();
+}
+
+//======================================
+//-------------ARITHMETIC---------------
+//======================================
+
+Pointer<Number> Complex::getSum(Pointer<Number> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toAdd->getSum(sharedThis());
+}
+
+Pointer<Number> Complex::getSum(Pointer<Complex> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	Pointer<RealNumber> real = staticPointerCast<RealNumber>(toAdd->m_real->getSum(m_real));
+	Pointer<RealNumber> im   = staticPointerCast<RealNumber>(toAdd->m_imaginary->getSum(m_imaginary));
+	return fromRealAndImaginary(real, im);
+}
+
+Pointer<Number> Complex::getSum(Pointer<FloatingPoint> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	Pointer<Complex> left = toAdd->getAsComplex();
+	return left->getSum(sharedThis());
+}
+
+Pointer<Number> Complex::getSum(Pointer<Signed> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	Pointer<Complex> left = toAdd->getAsComplex();
+	return left->getSum(sharedThis());
+}
+
+Pointer<Number> Complex::getSum(Pointer<Unsigned> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	Pointer<Complex> left = toAdd->getAsComplex();
+	return left->getSum(sharedThis());
+}
+
+Pointer<Number> Complex::getProduct(Pointer<Number> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toMultiply->getProduct(sharedThis());
+}
+
+Pointer<Number> Complex::getProduct(Pointer<Complex> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(toMultiply.get() == this) return getSquare();
+	if(isLongInteger(m_real) && isLongInteger(m_imaginary) &&
+			isLongInteger(toMultiply->m_real) && isLongInteger(toMultiply->m_imaginary)){
+		//Gauss: (a + bi)(c + di) = (c(a + b) - b(c + d)) + (c(a + b) + a(d - c))i
+		Pointer<RealNumber>
+			common = multiply(toMultiply->m_real, m_real->getSum(m_imaginary)),
+			re = multiply(m_imaginary, toMultiply->m_real->getSum(toMultiply->m_imaginary)),
+			im = multiply(m_real, toMultiply->m_imaginary->getDifference(toMultiply->m_real));
+		re = staticPointerCast<RealNumber>(common->getDifference(re));
+		im = staticPointerCast<RealNumber>(common->getSum(im));
+		return fromRealAndImaginary(re, im);
+	}
+	Pointer<RealNumber>
+		re1 = staticPointerCast<RealNumber>(m_real->getProduct(toMultiply->m_real)),
+		re2 = staticPointerCast<RealNumber>(m_imaginary->getProduct(toMultiply->m_imaginary));
+	Pointer<RealNumber>
+		im1 = staticPointerCast<RealNumber>(m_real->getProduct(toMultiply->m_imaginary)),
+		im2 = staticPointerCast<RealNumber>(m_imaginary->getProduct(toMultiply->m_real));
+	re1 = staticPointerCast<RealNumber>(re1->getDifference(re2));
+	im1 = staticPointerCast<RealNumber>(im1->getSum(im2));
+	return fromRealAndImaginary(re1, im1);
+}
+
+Pointer<Number> Complex::getProduct(Pointer<FloatingPoint> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	Pointer<Complex> left = toMultiply->getAsComplex();
+	return left->getProduct(sharedThis());
+}
+
+Pointer<Number> Complex::getProduct(Pointer<Signed> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	Pointer<Complex> left = toMultiply->getAsComplex();
+	return left->getProduct(sharedThis());
+}
+
+Pointer<Number> Complex::getProduct(Pointer<Unsigned> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	Pointer<Complex> left = toMultiply->getAsComplex();
+	return toMultiply->getProduct(sharedThis());
+}
+
+//======================================
+//---------------NUMBER-----------------
+//======================================
+
+Pointer<Number> Complex::getAbsoluteValue() const{
+}
+
+bool Complex::isZero() const noexcept{
+	return m_real->isZero() && m_imaginary->isZero();
+}
+
+NumberType Complex::getType() const noexcept{
+	return NumberType::Complex;
+}
+
+string Complex::getAsBinary() const{
+	return m_real->getAsBinary() + " + " + m_imaginary->getAsBinary() + " * i";
+}
+
+string Complex::getAsOctal() const{
+	return m_real->getAsOctal() + " + " + m_imaginary->getAsOctal() + " * i";
+}
+
+string Complex::getAsDecimal() const{
+	return m_real->getAsDecimal() + " + " + m_imaginary->getAsDecimal() + " * i";
+}
+
+string Complex::getAsHexadecimal() const{
+	return m_real->getAsHexadecimal() + " + " + m_imaginary->getAsHexadecimal() + " * i";
+}
+
+Pointer<Unsigned> Complex::getAsUnsignedInteger() const{
+	return m_real->getAsUnsignedInteger();
+}
+
+Pointer<Signed> Complex::getAsSignedInteger() const{
+	return m_real->getAsSignedInteger();
+}
+
+Pointer<FloatingPoint> Complex::getAsFloatingPoint() const{
+	return m_real->getAsFloatingPoint();
+}
+
+Pointer<Complex> Complex::getAsComplex() const{
+	return fromRealAndImaginary(m_real, m_imaginary);
+}
+
+Pointer<Number> Complex::getNegation() const{
+	Pointer<RealNumber> re = staticPointerCast<RealNumber>(m_real->getNegation()) ;
+	Pointer<RealNumber> im = staticPointerCast<RealNumber>(m_imaginary->getNegation());
+	return fromRealAndImaginary(re, im);
+}
+
+Pointer<Number> Complex::getInversion() const{
+	Pointer<RealNumber> re = staticPointerCast<RealNumber>(m_real->getProduct(m_real));
+	Pointer<RealNumber> im = staticPointerCast<RealNumber>(m_imaginary->getProduct(m_imaginary));
+	re = staticPointerCast<RealNumber>(re->getSum(im));
+	im = staticPointerCast<RealNumber>(m_imaginary->getQuotient(re));
+	re = staticPointerCast<RealNumber>(m_real->getQuotient(re));
+	im = staticPointerCast<RealNumber>(im->getNegation());
+	return fromRealAndImaginary(re, im);
+}
+
+Pointer<Complex> Complex::sharedThis() const{
+	return staticPointerCast<Complex>(shared_from_this());
+}
+
+} /* namespace numb */
+} /* namespace coma */
@@ -0,0 +1,450 @@
+/*
+ * FixedSigned.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_FIXEDSIGNED_H_
+#define NUMBERS_FIXEDSIGNED_H_
+
+#include "FixedUnsigned.h"
+#include "Signed.h"
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Integer of fixed number of bits in two's complement, stored in place.
+ *
+ * @details
+ * 	Bits of number are kept in FixedUnsigned of the same width, so addition, subtraction and wrapping
+ * 	multiplication are the unsigned ones, and only comparisons, shifts right and overflow checks depend on sign.
+ * 	Numbers are converted losslessly from and to Signed.
+ *
+ * @tparam Bits
+ * 	Number of bits, positive multiple of 64.
+ */
+template<std::size_t Bits>
+class FixedSigned {
+public:
+	/**
+	 * @brief
+	 * 	Creates zero.
+	 */
+	constexpr FixedSigned() noexcept : m_bits{}{}
+
+	/**
+	 * @brief
+	 * 	Creates number equal to given value.
+	 *
+	 * @param value
+	 * 	Value of number.
+	 */
+	constexpr explicit FixedSigned(long long value) noexcept;
+
+	/**
+	 * @brief
+	 * 	Creates number from its two's complement bits.
+	 *
+	 * @param bits
+	 * 	Bits of number.
+	 *
+	 * @return
+	 * 	New number.
+	 */
+	static constexpr FixedSigned fromBits(const FixedUnsigned<Bits> &bits) noexcept;
+
+	/**
+	 * @brief
+	 * 	Creates number from Integer.
+	 *
+	 * @details
+	 * 	Out of range is reported as overflow, which is detectable only with USE_EXCEPTIONS. Overload with
+	 * 	@a overflow tells it in every build.
+	 *
+	 * @param number
+	 * 	Integer from range [-2^(Bits-1), 2^(Bits-1)).
+	 *
+	 * @return
+	 * 	Number equal to @a number.
+	 */
+	static FixedSigned fromInteger(Pointer<Integer> number);
+
+	/**
+	 * @brief
+	 * 	Creates number from Integer, telling if it is out of range.
+	 *
+	 * @param number
+	 * 	Not null Integer.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if @a number is null or out of range [-2^(Bits-1), 2^(Bits-1)), else to false.
+	 *
+	 * @return
+	 * 	Number equal to @a number. On overflow zero is returned.
+	 */
+	static FixedSigned fromInteger(Pointer<Integer> number, bool &overflow);
+
+	/**
+	 * @brief
+	 * 	Creates Signed equal to this number.
+	 *
+	 * @return
+	 * 	New Signed.
+	 */
+	Pointer<Signed> getAsSigned() const;
+
+	/**
+	 * @brief
+	 * 	Bits getter.
+	 *
+	 * @return
+	 * 	Two's complement bits of number.
+	 */
+	constexpr const FixedUnsigned<Bits> &getBits() const noexcept{ return m_bits; }
+
+	/**
+	 * @brief
+	 * 	Checks if number is zero.
+	 *
+	 * @return
+	 * 	True if number is zero, else returns false.
+	 */
+	constexpr bool isZero() const noexcept{ return m_bits.isZero(); }
+
+	/**
+	 * @brief
+	 * 	Checks if number is negative.
+	 *
+	 * @return
+	 * 	True if number is lesser than zero, else returns false.
+	 */
+	constexpr bool isNegative() const noexcept{ return m_bits.getWord(FixedUnsigned<Bits>::WORDS - 1) >> 63; }
+
+	/**
+	 * @brief
+	 * 	Finds absolute value of number.
+	 *
+	 * @return
+	 * 	|number|, which is representable also for -2^(Bits-1).
+	 */
+	constexpr FixedUnsigned<Bits> getAbsoluteValue() const noexcept{ return isNegative() ? m_bits.getNegation() : m_bits; }
+
+	/**
+	 * @brief
+	 * 	Compares number with other number.
+	 *
+	 * @param toCompare
+	 * 	Number to compare with.
+	 *
+	 * @return
+	 * 	Result of comparison.
+	 */
+	constexpr CompareResult compare(const FixedSigned &toCompare) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Adds numbers modulo 2^Bits.
+	 *
+	 * @param toAdd
+	 * 	Number to add.
+	 *
+	 * @return
+	 * 	Sum of numbers, wrapped to range of number.
+	 */
+	constexpr FixedSigned getSum(const FixedSigned &toAdd) const noexcept{ return fromBits(m_bits + toAdd.m_bits); }
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers modulo 2^Bits.
+	 *
+	 * @param toSubtract
+	 * 	Number to subtract.
+	 *
+	 * @return
+	 * 	Difference of numbers, wrapped to range of number.
+	 */
+	constexpr FixedSigned getDifference(const FixedSigned &toSubtract) const noexcept{
+		return fromBits(m_bits - toSubtract.m_bits);
+	}
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers modulo 2^Bits.
+	 *
+	 * @param toMultiply
+	 * 	Number to multiply by.
+	 *
+	 * @return
+	 * 	Product of numbers, wrapped to range of number.
+	 */
+	constexpr FixedSigned getProduct(const FixedSigned &toMultiply) const noexcept{
+		return fromBits(m_bits * toMultiply.m_bits);
+	}
+
+	/**
+	 * @brief
+	 * 	Negates number modulo 2^Bits.
+	 *
+	 * @return
+	 * 	Negation of number, or -2^(Bits-1) for -2^(Bits-1).
+	 */
+	constexpr FixedSigned getNegation() const noexcept{ return fromBits(m_bits.getNegation()); }
+
+	/**
+	 * @brief
+	 * 	Shifts number left, dropping bits above number of bits.
+	 *
+	 * @param bits
+	 * 	Number of bits to shift by.
+	 *
+	 * @return
+	 * 	Number multiplied by 2^@a bits, wrapped to range of number.
+	 */
+	constexpr FixedSigned getShiftedLeft(std::size_t bits) const noexcept{ return fromBits(m_bits << bits); }
+
+	/**
+	 * @brief
+	 * 	Shifts number right, copying sign bit.
+	 *
+	 * @param bits
+	 * 	Number of bits to shift by.
+	 *
+	 * @return
+	 * 	Number divided by 2^@a bits, rounded towards minus infinity.
+	 */
+	constexpr FixedSigned getShiftedRight(std::size_t bits) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Adds numbers, reporting overflow.
+	 *
+	 * @details
+	 * 	Overflow is detectable only with USE_EXCEPTIONS, overload with @a overflow tells it in every build.
+	 *
+	 * @param toAdd
+	 * 	Number to add.
+	 *
+	 * @return
+	 * 	Sum of numbers.
+	 */
+	constexpr FixedSigned getCheckedSum(const FixedSigned &toAdd) const noexcept(NOEXCEPT_FLAG);
+
+	/**
+	 * @brief
+	 * 	Adds numbers, telling if overflow occurred.
+	 *
+	 * @param toAdd
+	 * 	Number to add.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if the sum is out of range [-2^(Bits-1), 2^(Bits-1)), else to false.
+	 *
+	 * @return
+	 * 	Sum of numbers wrapped around to Bits bits.
+	 */
+	constexpr FixedSigned getCheckedSum(const FixedSigned &toAdd, bool &overflow) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers, reporting overflow.
+	 *
+	 * @details
+	 * 	Overflow is detectable only with USE_EXCEPTIONS, overload with @a overflow tells it in every build.
+	 *
+	 * @param toSubtract
+	 * 	Number to subtract.
+	 *
+	 * @return
+	 * 	Difference of numbers.
+	 */
+	constexpr FixedSigned getCheckedDifference(const FixedSigned &toSubtract) const noexcept(NOEXCEPT_FLAG);
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers, telling if overflow occurred.
+	 *
+	 * @param toSubtract
+	 * 	Number to subtract.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if the difference is out of range [-2^(Bits-1), 2^(Bits-1)), else to false.
+	 *
+	 * @return
+	 * 	Difference of numbers wrapped around to Bits bits.
+	 */
+	constexpr FixedSigned getCheckedDifference(const FixedSigned &toSubtract, bool &overflow) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers, reporting overflow.
+	 *
+	 * @details
+	 * 	Overflow is detectable only with USE_EXCEPTIONS, overload with @a overflow tells it in every build.
+	 *
+	 * @param toMultiply
+	 * 	Number to multiply by.
+	 *
+	 * @return
+	 * 	Product of numbers.
+	 */
+	constexpr FixedSigned getCheckedProduct(const FixedSigned &toMultiply) const noexcept(NOEXCEPT_FLAG);
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers, telling if overflow occurred.
+	 *
+	 * @param toMultiply
+	 * 	Number to multiply by.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if the product is out of range [-2^(Bits-1), 2^(Bits-1)), else to false.
+	 *
+	 * @return
+	 * 	Product of numbers wrapped around to Bits bits.
+	 */
+	constexpr FixedSigned getCheckedProduct(const FixedSigned &toMultiply, bool &overflow) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Wrap-around arithmetic and comparison operators, equivalent to methods above.
+	 */
+	constexpr FixedSigned operator+(const FixedSigned &rhs) const noexcept{ return getSum(rhs); }
+	constexpr FixedSigned operator-(const FixedSigned &rhs) const noexcept{ return getDifference(rhs); }
+	constexpr FixedSigned operator*(const FixedSigned &rhs) const noexcept{ return getProduct(rhs); }
+	constexpr FixedSigned operator-() const noexcept{ return getNegation(); }
+	constexpr FixedSigned operator<<(std::size_t bits) const noexcept{ return getShiftedLeft(bits); }
+	constexpr FixedSigned operator>>(std::size_t bits) const noexcept{ return getShiftedRight(bits); }
+
+	constexpr bool operator==(const FixedSigned &rhs) const noexcept{ return m_bits == rhs.m_bits; }
+	constexpr bool operator!=(const FixedSigned &rhs) const noexcept{ return m_bits != rhs.m_bits; }
+	constexpr bool operator<(const FixedSigned &rhs) const noexcept{ return compare(rhs) == CompareResult::ThisLesser; }
+	constexpr bool operator>(const FixedSigned &rhs) const noexcept{ return compare(rhs) == CompareResult::ThisGreater; }
+	constexpr bool operator<=(const FixedSigned &rhs) const noexcept{ return compare(rhs) != CompareResult::ThisGreater; }
+	constexpr bool operator>=(const FixedSigned &rhs) const noexcept{ return compare(rhs) != CompareResult::ThisLesser; }
+
+private:
+	/**
+	 * @brief
+	 * 	Two's complement bits of number.
+	 */
+	FixedUnsigned<Bits> m_bits;
+};
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits>::FixedSigned(long long value) noexcept : m_bits{}{
+	unsigned long long words[FixedUnsigned<Bits>::WORDS] {};
+	words[0] = static_cast<unsigned long long>(value);
+	for(std::size_t i = 1; i < FixedUnsigned<Bits>::WORDS; ++i) words[i] = value < 0 ? ~0ull : 0;
+	m_bits = FixedUnsigned<Bits>::fromWords(words, FixedUnsigned<Bits>::WORDS);
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::fromBits(const FixedUnsigned<Bits> &bits) noexcept{
+	FixedSigned result;
+	result.m_bits = bits;
+	return result;
+}
+
+template<std::size_t Bits>
+FixedSigned<Bits> FixedSigned<Bits>::fromInteger(Pointer<Integer> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), FixedSigned());
+	bool overflow { false };
+	FixedSigned result { fromInteger(number, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+FixedSigned<Bits> FixedSigned<Bits>::fromInteger(Pointer<Integer> number, bool &overflow){
+	overflow = !number;
+	if(overflow) return FixedSigned();
+	//arrays hold absolute values, so negative numbers are negated after reading
+	const tech::RuntimeArray<unsigned char> &array = number->getArray();
+	unsigned long long words[FixedUnsigned<Bits>::WORDS] {};
+	for(std::size_t i = 0; i < array.length(); ++i){
+		if(i < Bits / 8) words[i / 8] |= static_cast<unsigned long long>(array[i]) << (8 * (i % 8));
+		else if(array[i]) overflow = true;
+	}
+	FixedUnsigned<Bits> magnitude { FixedUnsigned<Bits>::fromWords(words, FixedUnsigned<Bits>::WORDS) };
+	FixedSigned result { fromBits(number->isNegative() ? magnitude.getNegation() : magnitude) };
+	if(result.isNegative() != number->isNegative()) overflow = true;
+	return overflow ? FixedSigned() : result;
+}
+
+template<std::size_t Bits>
+Pointer<Signed> FixedSigned<Bits>::getAsSigned() const{
+	tech::RuntimeArray<unsigned char> array(Bits / 8);
+	for(std::size_t i = 0; i < array.length(); ++i) array[i] = static_cast<unsigned char>(m_bits.getWord(i / 8) >> (8 * (i % 8)));
+	return Signed::fromLittleEndianArray(array);
+}
+
+template<std::size_t Bits>
+constexpr CompareResult FixedSigned<Bits>::compare(const FixedSigned &toCompare) const noexcept{
+	if(isNegative() != toCompare.isNegative()) return isNegative() ? CompareResult::ThisLesser : CompareResult::ThisGreater;
+	//numbers of equal signs are ordered as their bits
+	return m_bits.compare(toCompare.m_bits);
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::getShiftedRight(std::size_t bits) const noexcept{
+	if(!isNegative()) return fromBits(m_bits >> bits);
+	//~(~x >> n) copies sign bit into the vacated positions
+	FixedUnsigned<Bits> complement { m_bits.getNegation() - FixedUnsigned<Bits>(1) };
+	return fromBits((complement >> bits).getNegation() - FixedUnsigned<Bits>(1));
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::getCheckedSum(const FixedSigned &toAdd) const noexcept(NOEXCEPT_FLAG){
+	bool overflow { false };
+	FixedSigned result { getCheckedSum(toAdd, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::getCheckedSum(const FixedSigned &toAdd, bool &overflow) const noexcept{
+	FixedSigned result { getSum(toAdd) };
+	overflow = isNegative() == toAdd.isNegative() && result.isNegative() != isNegative();
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::getCheckedDifference(const FixedSigned &toSubtract) const noexcept(NOEXCEPT_FLAG){
+	bool overflow { false };
+	FixedSigned result { getCheckedDifference(toSubtract, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::getCheckedDifference(const FixedSigned &toSubtract, bool &overflow) const noexcept{
+	FixedSigned result { getDifference(toSubtract) };
+	overflow = isNegative() != toSubtract.isNegative() && result.isNegative() != isNegative();
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::getCheckedProduct(const FixedSigned &toMultiply) const noexcept(NOEXCEPT_FLAG){
+	bool overflow { false };
+	FixedSigned result { getCheckedProduct(toMultiply, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedSigned<Bits> FixedSigned<Bits>::getCheckedProduct(const FixedSigned &toMultiply, bool &overflow) const noexcept{
+	FixedUnsigned<2 * Bits> magnitude { getAbsoluteValue().getFullProduct(toMultiply.getAbsoluteValue()) };
+	FixedUnsigned<2 * Bits> limit { FixedUnsigned<2 * Bits>(1) << (Bits - 1) };
+	//-2^(Bits-1) is the only product of magnitude 2^(Bits-1) in range
+	bool isNegativeProduct { isNegative() != toMultiply.isNegative() && !magnitude.isZero() };
+	overflow = isNegativeProduct ? magnitude > limit : magnitude >= limit;
+	return getProduct(toMultiply);
+}
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_FIXEDSIGNED_H_ */
@@ -0,0 +1,648 @@
+/*
+ * FixedUnsigned.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_FIXEDUNSIGNED_H_
+#define NUMBERS_FIXEDUNSIGNED_H_
+
+#include "Integer.h"
+#include "Unsigned.h"
+#include "../defines.h"
+
+#include <cstddef>
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Non-negative integer of fixed number of bits, stored in place.
+ *
+ * @details
+ * 	Value is kept in inline array of 64 bit words in little-endian order, so no memory is allocated and number
+ * 	can be copied trivially. All loops run over number of words known at compile time, so compilers unroll them,
+ * 	and all arithmetic is constexpr. Basic operations wrap around modulo 2^Bits, while checked ones report
+ * 	overflow. Numbers are converted losslessly from and to Unsigned.
+ *
+ * @tparam Bits
+ * 	Number of bits, positive multiple of 64.
+ */
+template<std::size_t Bits>
+class FixedUnsigned {
+	static_assert(Bits && Bits % 64 == 0, "Number of bits must be positive multiple of 64");
+
+	template<std::size_t OtherBits>
+	friend class FixedUnsigned;
+public:
+	/**
+	 * @brief
+	 * 	Number of 64 bit words of number.
+	 */
+	static constexpr std::size_t WORDS { Bits / 64 };
+
+	/**
+	 * @brief
+	 * 	Creates zero.
+	 */
+	constexpr FixedUnsigned() noexcept : m_words{}{}
+
+	/**
+	 * @brief
+	 * 	Creates number equal to given word.
+	 *
+	 * @param value
+	 * 	Value of number.
+	 */
+	constexpr explicit FixedUnsigned(unsigned long long value) noexcept : m_words{}{
+		m_words[0] = value;
+	}
+
+	/**
+	 * @brief
+	 * 	Creates number from words.
+	 *
+	 * @param words
+	 * 	Words of number in little-endian order.
+	 *
+	 * @param length
+	 * 	Number of words. Words above number of bits are dropped, as in wrap-around arithmetic.
+	 *
+	 * @return
+	 * 	New number.
+	 */
+	static constexpr FixedUnsigned fromWords(const unsigned long long *words, std::size_t length) noexcept;
+
+	/**
+	 * @brief
+	 * 	Creates number from Integer.
+	 *
+	 * @details
+	 * 	Out of range is reported as overflow, which is detectable only with USE_EXCEPTIONS. Overload with
+	 * 	@a overflow tells it in every build.
+	 *
+	 * @param number
+	 * 	Non-negative Integer lesser than 2^Bits.
+	 *
+	 * @return
+	 * 	Number equal to @a number.
+	 */
+	static FixedUnsigned fromInteger(Pointer<Integer> number);
+
+	/**
+	 * @brief
+	 * 	Creates number from Integer, telling if it is out of range.
+	 *
+	 * @param number
+	 * 	Not null Integer.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if @a number is null, negative or not lesser than 2^Bits, else to false.
+	 *
+	 * @return
+	 * 	Number equal to @a number. On overflow zero is returned.
+	 */
+	static FixedUnsigned fromInteger(Pointer<Integer> number, bool &overflow);
+
+	/**
+	 * @brief
+	 * 	Creates Unsigned equal to this number.
+	 *
+	 * @return
+	 * 	New Unsigned.
+	 */
+	Pointer<Unsigned> getAsUnsigned() const;
+
+	/**
+	 * @brief
+	 * 	Word getter.
+	 *
+	 * @param index
+	 * 	Index of word, lesser than WORDS.
+	 *
+	 * @return
+	 * 	Word at @a index, counting from the least significant.
+	 */
+	constexpr unsigned long long getWord(std::size_t index) const noexcept{ return m_words[index]; }
+
+	/**
+	 * @brief
+	 * 	Checks if number is zero.
+	 *
+	 * @return
+	 * 	True if number is zero, else returns false.
+	 */
+	constexpr bool isZero() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Finds length of number in bits.
+	 *
+	 * @return
+	 * 	Position of the highest set bit plus one, zero for zero.
+	 */
+	constexpr std::size_t getBitLength() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Compares number with other number.
+	 *
+	 * @param toCompare
+	 * 	Number to compare with.
+	 *
+	 * @return
+	 * 	Result of comparison.
+	 */
+	constexpr CompareResult compare(const FixedUnsigned &toCompare) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Adds numbers modulo 2^Bits.
+	 *
+	 * @param toAdd
+	 * 	Number to add.
+	 *
+	 * @return
+	 * 	Sum of numbers modulo 2^Bits.
+	 */
+	constexpr FixedUnsigned getSum(const FixedUnsigned &toAdd) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers modulo 2^Bits.
+	 *
+	 * @param toSubtract
+	 * 	Number to subtract.
+	 *
+	 * @return
+	 * 	Difference of numbers modulo 2^Bits.
+	 */
+	constexpr FixedUnsigned getDifference(const FixedUnsigned &toSubtract) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers modulo 2^Bits.
+	 *
+	 * @details
+	 * 	Only products of words which contribute to the lower Bits bits are computed.
+	 *
+	 * @param toMultiply
+	 * 	Number to multiply by.
+	 *
+	 * @return
+	 * 	Product of numbers modulo 2^Bits.
+	 */
+	constexpr FixedUnsigned getProduct(const FixedUnsigned &toMultiply) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers without loss of bits.
+	 *
+	 * @param toMultiply
+	 * 	Number to multiply by.
+	 *
+	 * @return
+	 * 	Product of numbers.
+	 */
+	constexpr FixedUnsigned<2 * Bits> getFullProduct(const FixedUnsigned &toMultiply) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Negates number modulo 2^Bits.
+	 *
+	 * @return
+	 * 	2^Bits minus number, or zero for zero.
+	 */
+	constexpr FixedUnsigned getNegation() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Shifts number left, dropping bits above number of bits.
+	 *
+	 * @param bits
+	 * 	Number of bits to shift by.
+	 *
+	 * @return
+	 * 	Number multiplied by 2^@a bits modulo 2^Bits.
+	 */
+	constexpr FixedUnsigned getShiftedLeft(std::size_t bits) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Shifts number right.
+	 *
+	 * @param bits
+	 * 	Number of bits to shift by.
+	 *
+	 * @return
+	 * 	Number divided by 2^@a bits, rounded down.
+	 */
+	constexpr FixedUnsigned getShiftedRight(std::size_t bits) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Adds numbers, reporting overflow.
+	 *
+	 * @details
+	 * 	Overflow is detectable only with USE_EXCEPTIONS, overload with @a overflow tells it in every build.
+	 *
+	 * @param toAdd
+	 * 	Number to add.
+	 *
+	 * @return
+	 * 	Sum of numbers.
+	 */
+	constexpr FixedUnsigned getCheckedSum(const FixedUnsigned &toAdd) const noexcept(NOEXCEPT_FLAG);
+
+	/**
+	 * @brief
+	 * 	Adds numbers, telling if overflow occurred.
+	 *
+	 * @param toAdd
+	 * 	Number to add.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if the sum does not fit in Bits bits, else to false.
+	 *
+	 * @return
+	 * 	Sum of numbers modulo 2^Bits.
+	 */
+	constexpr FixedUnsigned getCheckedSum(const FixedUnsigned &toAdd, bool &overflow) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers, reporting overflow.
+	 *
+	 * @details
+	 * 	Overflow is detectable only with USE_EXCEPTIONS, overload with @a overflow tells it in every build.
+	 *
+	 * @param toSubtract
+	 * 	Number not greater than this number.
+	 *
+	 * @return
+	 * 	Difference of numbers.
+	 */
+	constexpr FixedUnsigned getCheckedDifference(const FixedUnsigned &toSubtract) const noexcept(NOEXCEPT_FLAG);
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers, telling if overflow occurred.
+	 *
+	 * @param toSubtract
+	 * 	Number not greater than this number.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if the difference does not fit in Bits bits, else to false.
+	 *
+	 * @return
+	 * 	Difference of numbers modulo 2^Bits.
+	 */
+	constexpr FixedUnsigned getCheckedDifference(const FixedUnsigned &toSubtract, bool &overflow) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers, reporting overflow.
+	 *
+	 * @details
+	 * 	Overflow is detectable only with USE_EXCEPTIONS, overload with @a overflow tells it in every build.
+	 *
+	 * @param toMultiply
+	 * 	Number to multiply by.
+	 *
+	 * @return
+	 * 	Product of numbers.
+	 */
+	constexpr FixedUnsigned getCheckedProduct(const FixedUnsigned &toMultiply) const noexcept(NOEXCEPT_FLAG);
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers, telling if overflow occurred.
+	 *
+	 * @param toMultiply
+	 * 	Number to multiply by.
+	 *
+	 * @param overflow
+	 * 	Variable set to true if the product does not fit in Bits bits, else to false.
+	 *
+	 * @return
+	 * 	Product of numbers modulo 2^Bits.
+	 */
+	constexpr FixedUnsigned getCheckedProduct(const FixedUnsigned &toMultiply, bool &overflow) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Wrap-around arithmetic and comparison operators, equivalent to methods above.
+	 */
+	constexpr FixedUnsigned operator+(const FixedUnsigned &rhs) const noexcept{ return getSum(rhs); }
+	constexpr FixedUnsigned operator-(const FixedUnsigned &rhs) const noexcept{ return getDifference(rhs); }
+	constexpr FixedUnsigned operator*(const FixedUnsigned &rhs) const noexcept{ return getProduct(rhs); }
+	constexpr FixedUnsigned operator-() const noexcept{ return getNegation(); }
+	constexpr FixedUnsigned operator<<(std::size_t bits) const noexcept{ return getShiftedLeft(bits); }
+	constexpr FixedUnsigned operator>>(std::size_t bits) const noexcept{ return getShiftedRight(bits); }
+
+	constexpr bool operator==(const FixedUnsigned &rhs) const noexcept{ return compare(rhs) == CompareResult::Equal; }
+	constexpr bool operator!=(const FixedUnsigned &rhs) const noexcept{ return compare(rhs) != CompareResult::Equal; }
+	constexpr bool operator<(const FixedUnsigned &rhs) const noexcept{ return compare(rhs) == CompareResult::ThisLesser; }
+	constexpr bool operator>(const FixedUnsigned &rhs) const noexcept{ return compare(rhs) == CompareResult::ThisGreater; }
+	constexpr bool operator<=(const FixedUnsigned &rhs) const noexcept{ return compare(rhs) != CompareResult::ThisGreater; }
+	constexpr bool operator>=(const FixedUnsigned &rhs) const noexcept{ return compare(rhs) != CompareResult::ThisLesser; }
+
+private:
+	/**
+	 * @brief
+	 * 	Adds number to this number in place.
+	 *
+	 * @param toAdd
+	 * 	Number to add.
+	 *
+	 * @return
+	 * 	Carry out of the highest word.
+	 */
+	constexpr unsigned long long add(const FixedUnsigned &toAdd) noexcept;
+
+	/**
+	 * @brief
+	 * 	Subtracts number from this number in place.
+	 *
+	 * @param toSubtract
+	 * 	Number to subtract.
+	 *
+	 * @return
+	 * 	Borrow out of the highest word.
+	 */
+	constexpr unsigned long long subtract(const FixedUnsigned &toSubtract) noexcept;
+
+	/**
+	 * @brief
+	 * 	Multiplies two words.
+	 *
+	 * @param lhs
+	 * 	First factor.
+	 *
+	 * @param rhs
+	 * 	Second factor.
+	 *
+	 * @param high
+	 * 	Variable for higher word of product.
+	 *
+	 * @return
+	 * 	Lower word of product.
+	 */
+	static constexpr unsigned long long multiplyWords(unsigned long long lhs, unsigned long long rhs,
+			unsigned long long &high) noexcept;
+
+	/**
+	 * @brief
+	 * 	Words of number in little-endian order.
+	 *
+	 * @details
+	 * 	Plain array is used, as elements of std::array cannot be modified in constexpr functions in C++14.
+	 */
+	unsigned long long m_words[WORDS];
+};
+
+template<std::size_t Bits>
+constexpr std::size_t FixedUnsigned<Bits>::WORDS;
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::fromWords(const unsigned long long *words, std::size_t length) noexcept{
+	FixedUnsigned result;
+	for(std::size_t i = 0; i < WORDS && i < length; ++i) result.m_words[i] = words[i];
+	return result;
+}
+
+template<std::size_t Bits>
+FixedUnsigned<Bits> FixedUnsigned<Bits>::fromInteger(Pointer<Integer> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), FixedUnsigned());
+	bool overflow { false };
+	FixedUnsigned result { fromInteger(number, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+FixedUnsigned<Bits> FixedUnsigned<Bits>::fromInteger(Pointer<Integer> number, bool &overflow){
+	overflow = !number || number->isNegative();
+	if(overflow) return FixedUnsigned();
+	const tech::RuntimeArray<unsigned char> &array = number->getArray();
+	FixedUnsigned result;
+	for(std::size_t i = 0; i < array.length(); ++i){
+		if(i < Bits / 8) result.m_words[i / 8] |= static_cast<unsigned long long>(array[i]) << (8 * (i % 8));
+		else if(array[i]) overflow = true;
+	}
+	return overflow ? FixedUnsigned() : result;
+}
+
+template<std::size_t Bits>
+Pointer<Unsigned> FixedUnsigned<Bits>::getAsUnsigned() const{
+	tech::RuntimeArray<unsigned char> array(Bits / 8);
+	for(std::size_t i = 0; i < array.length(); ++i) array[i] = static_cast<unsigned char>(m_words[i / 8] >> (8 * (i % 8)));
+	return Unsigned::fromLittleEndianArray(array);
+}
+
+template<std::size_t Bits>
+constexpr bool FixedUnsigned<Bits>::isZero() const noexcept{
+	for(std::size_t i = 0; i < WORDS; ++i){
+		if(m_words[i]) return false;
+	}
+	return true;
+}
+
+template<std::size_t Bits>
+constexpr std::size_t FixedUnsigned<Bits>::getBitLength() const noexcept{
+	for(std::size_t i = WORDS; i-- > 0;){
+		if(!m_words[i]) continue;
+		std::size_t length { 64 * i };
+		for(unsigned long long word = m_words[i]; word; word >>= 1) ++length;
+		return length;
+	}
+	return 0;
+}
+
+template<std::size_t Bits>
+constexpr CompareResult FixedUnsigned<Bits>::compare(const FixedUnsigned &toCompare) const noexcept{
+	for(std::size_t i = WORDS; i-- > 0;){
+		if(m_words[i] != toCompare.m_words[i]){
+			return m_words[i] > toCompare.m_words[i] ? CompareResult::ThisGreater : CompareResult::ThisLesser;
+		}
+	}
+	return CompareResult::Equal;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getSum(const FixedUnsigned &toAdd) const noexcept{
+	FixedUnsigned result { *this };
+	result.add(toAdd);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getDifference(const FixedUnsigned &toSubtract) const noexcept{
+	FixedUnsigned result { *this };
+	result.subtract(toSubtract);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getProduct(const FixedUnsigned &toMultiply) const noexcept{
+	FixedUnsigned result;
+	for(std::size_t i = 0; i < WORDS; ++i){
+		unsigned long long carry { 0 };
+		for(std::size_t j = 0; i + j < WORDS; ++j){
+			unsigned long long high { 0 };
+			unsigned long long low { multiplyWords(m_words[i], toMultiply.m_words[j], high) };
+			low += carry;
+			high += low < carry ? 1 : 0;
+			result.m_words[i + j] += low;
+			high += result.m_words[i + j] < low ? 1 : 0;
+			carry = high;
+		}
+	}
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<2 * Bits> FixedUnsigned<Bits>::getFullProduct(const FixedUnsigned &toMultiply) const noexcept{
+	FixedUnsigned<2 * Bits> result;
+	for(std::size_t i = 0; i < WORDS; ++i){
+		unsigned long long carry { 0 };
+		for(std::size_t j = 0; j < WORDS; ++j){
+			unsigned long long high { 0 };
+			unsigned long long low { multiplyWords(m_words[i], toMultiply.m_words[j], high) };
+			low += carry;
+			high += low < carry ? 1 : 0;
+			result.m_words[i + j] += low;
+			high += result.m_words[i + j] < low ? 1 : 0;
+			carry = high;
+		}
+		result.m_words[i + WORDS] = carry;
+	}
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getNegation() const noexcept{
+	return FixedUnsigned().getDifference(*this);
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getShiftedLeft(std::size_t bits) const noexcept{
+	FixedUnsigned result;
+	if(bits >= Bits) return result;
+	std::size_t words { bits / 64 }, shift { bits % 64 };
+	for(std::size_t i = WORDS; i-- > words;){
+		result.m_words[i] = m_words[i - words] << shift;
+		if(shift && i > words) result.m_words[i] |= m_words[i - words - 1] >> (64 - shift);
+	}
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getShiftedRight(std::size_t bits) const noexcept{
+	FixedUnsigned result;
+	if(bits >= Bits) return result;
+	std::size_t words { bits / 64 }, shift { bits % 64 };
+	for(std::size_t i = 0; i + words < WORDS; ++i){
+		result.m_words[i] = m_words[i + words] >> shift;
+		if(shift && i + words + 1 < WORDS) result.m_words[i] |= m_words[i + words + 1] << (64 - shift);
+	}
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getCheckedSum(const FixedUnsigned &toAdd) const noexcept(NOEXCEPT_FLAG){
+	bool overflow { false };
+	FixedUnsigned result { getCheckedSum(toAdd, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getCheckedSum(const FixedUnsigned &toAdd, bool &overflow) const noexcept{
+	FixedUnsigned result { *this };
+	overflow = result.add(toAdd) != 0;
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getCheckedDifference(const FixedUnsigned &toSubtract) const noexcept(NOEXCEPT_FLAG){
+	bool overflow { false };
+	FixedUnsigned result { getCheckedDifference(toSubtract, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getCheckedDifference(const FixedUnsigned &toSubtract, bool &overflow) const noexcept{
+	FixedUnsigned result { *this };
+	overflow = result.subtract(toSubtract) != 0;
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getCheckedProduct(const FixedUnsigned &toMultiply) const noexcept(NOEXCEPT_FLAG){
+	bool overflow { false };
+	FixedUnsigned result { getCheckedProduct(toMultiply, overflow) };
+	if(overflow) REPORT_ERROR(std::exception("Overflow exception"), result);
+	return result;
+}
+
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> FixedUnsigned<Bits>::getCheckedProduct(const FixedUnsigned &toMultiply, bool &overflow) const noexcept{
+	FixedUnsigned<2 * Bits> product { getFullProduct(toMultiply) };
+	overflow = false;
+	for(std::size_t i = WORDS; i < 2 * WORDS; ++i){
+		if(product.m_words[i]) overflow = true;
+	}
+	return fromWords(product.m_words, WORDS);
+}
+
+template<std::size_t Bits>
+constexpr unsigned long long FixedUnsigned<Bits>::add(const FixedUnsigned &toAdd) noexcept{
+	unsigned long long carry { 0 };
+	for(std::size_t i = 0; i < WORDS; ++i){
+		unsigned long long sum { m_words[i] + carry };
+		carry = sum < carry ? 1 : 0;
+		sum += toAdd.m_words[i];
+		carry += sum < toAdd.m_words[i] ? 1 : 0;
+		m_words[i] = sum;
+	}
+	return carry;
+}
+
+template<std::size_t Bits>
+constexpr unsigned long long FixedUnsigned<Bits>::subtract(const FixedUnsigned &toSubtract) noexcept{
+	unsigned long long borrow { 0 };
+	for(std::size_t i = 0; i < WORDS; ++i){
+		unsigned long long subtrahend { toSubtract.m_words[i] + borrow };
+		borrow = subtrahend < borrow || m_words[i] < subtrahend ? 1 : 0;
+		m_words[i] -= subtrahend;
+	}
+	return borrow;
+}
+
+template<std::size_t Bits>
+constexpr unsigned long long FixedUnsigned<Bits>::multiplyWords(unsigned long long lhs, unsigned long long rhs,
+		unsigned long long &high) noexcept{
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product { static_cast<unsigned __int128>(lhs) * rhs };
+	high = static_cast<unsigned long long>(product >> 64);
+	return static_cast<unsigned long long>(product);
+#else
+	unsigned long long
+		lhsLow { lhs & 0xFFFFFFFF }, lhsHigh { lhs >> 32 },
+		rhsLow { rhs & 0xFFFFFFFF }, rhsHigh { rhs >> 32 },
+		lowLow { lhsLow * rhsLow },
+		middle { lhsHigh * rhsLow + (lowLow >> 32) },
+		middleTwo { lhsLow * rhsHigh + (middle & 0xFFFFFFFF) };
+	high = lhsHigh * rhsHigh + (middle >> 32) + (middleTwo >> 32);
+	return (middleTwo << 32) | (lowLow & 0xFFFFFFFF);
+#endif
+}
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_FIXEDUNSIGNED_H_ */
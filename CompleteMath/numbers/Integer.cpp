@@ -1,78 +1,168 @@
-/*
- * Integer.cpp
- *
- *  Created on: 26 cze 2015
- *      Author: Bartosz Miera
- */
-
-#include "Integer.h"
-#include "FloatingPoint.h"
-#include "Signed.h"
-#include "Unsigned.h"
-
-#include "../Utility/Numbers.h"
-#include "../Utility/ArrayArithmetic.h"
-
-#include <algorithm>
-#include <memory>
-
-namespace coma{
-namespace numb{
-
-Integer::Integer(const tech::RuntimeArray<unsigned char> &numbersArray, const Endianess endianess):
-		m_integer(endianess == Endianess::Little ? numbersArray : util::reverse(numbersArray)){}
-
-const tech::RuntimeArray<unsigned char> &Integer::getArray() const noexcept{
-	return m_integer;
-}
-
-Pointer<Integer> Integer::fromLittleEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned){
-	if(!asSigned) return Unsigned::fromLittleEndianArray(array);
-	else{
-		if(array[array.length() - 1] & 0x80) return Signed::fromLittleEndianArray(array);
-		else return Unsigned::fromLittleEndianArray(array);
-	}
-}
-
-Pointer<Integer> Integer::fromBigEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned){
-	if(!asSigned) return Unsigned::fromBigEndianArray(array);
-	else{
-		if(array[array.length() - 1] & 0x80) return Signed::fromBigEndianArray(array);
-		else return Unsigned::fromBigEndianArray(array);
-	}
-}
-
-Pointer<Integer> Integer::fromBinaryInString(const std::string &binary){
-	if(binary[0] == '-') return Signed::fromBinaryInString(binary);
-	else{
-		if(binary[0] == '+') return Unsigned::fromBinaryInString(binary.substr(1, binary.length() - 1));
-		else return Unsigned::fromBinaryInString(binary);
-	}
-}
-
-Pointer<Integer> Integer::fromOctalInString(const std::string &octal){
-	if(octal[0] == '-') return Signed::fromOctalInString(octal);
-	else{
-		if(octal[0] == '+') return Unsigned::fromOctalInString(octal.substr(1, octal.length() - 1));
-		else return Unsigned::fromOctalInString(octal);
-	}
-}
-
-Pointer<Integer> Integer::fromDecimalInString(const std::string &decimal){
-	if(decimal[0] == '-') return Signed::fromDecimalInString(decimal);
-	else{
-		if(decimal[0] == '+') return Unsigned::fromDecimalInString(decimal.substr(1, decimal.length() - 1));
-		else return Unsigned::fromDecimalInString(decimal);
-	}
-}
-
-Pointer<Integer> Integer::fromHexadecimalInString(const std::string &hex){
-	if(hex[0] == '-') return Signed::fromHexadecimalInString(hex);
-	else{
-		if(hex[0] == '+') return Unsigned::fromHexadecimalInString(hex.substr(1, hex.length() - 1));
-		else return Unsigned::fromHexadecimalInString(hex);
-	}
-}
-
-}/* namespace numb */
-} /* namespace coma */
+/*
+ * Integer.cpp
+ *
+ *  Created on: 26 cze 2015
+ *      Author: Bartosz Miera
+ */
+
+#include "Integer.h"
+#include "FloatingPoint.h"
+#include "Signed.h"
+#include "Unsigned.h"
+
+#include "../Utility/Numbers.h"
+#include "../Utility/ArrayArithmetic.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace coma{
+namespace numb{
+
+Integer::Integer(const tech::RuntimeArray<unsigned char> &numbersArray, const Endianess endianess):
+		m_integer(std::make_shared<const tech::RuntimeArray<unsigned char>>(
+				endianess == Endianess::Little ? numbersArray : util::reverse(numbersArray))){}
+
+const tech::RuntimeArray<unsigned char> &Integer::getArray() const noexcept{
+	return *m_integer;
+}
+
+bool Integer::isInteger() const noexcept{
+	return true;
+}
+
+bool Integer::isPowerOfTwo() const{
+	unsigned long long bits { 0 };
+	for(unsigned long long i = 0; i < getArray().length() && bits < 2; ++i){
+		for(unsigned char byte = getArray()[i]; byte; byte &= byte - 1) ++bits;
+	}
+	return bits == 1;
+}
+
+Pointer<Integer> Integer::fromMagnitude(const tech::RuntimeArray<unsigned char> &magnitude, bool isNegative){
+	if(isNegative) return Signed::fromMagnitude(magnitude, true);
+	else return Unsigned::fromLittleEndianArray(magnitude);
+}
+
+Pointer<Integer> Integer::getSignedSum(const Integer &augend, const Integer &addend, bool isSubtraction){
+	using namespace util;
+	const tech::RuntimeArray<unsigned char> &left = augend.getArray(), &right = addend.getArray();
+	bool isAddendNegative { addend.isNegative() != isSubtraction };
+	if(augend.isNegative() == isAddendNegative){
+		//one more byte for carry
+		tech::RuntimeArray<unsigned char> tmp(std::max(left.length(), right.length()) + 1);
+		std::copy(left.begin(), left.end(), tmp.begin());
+		tmp += right;
+		return fromMagnitude(tmp, isAddendNegative);
+	}
+	bool isAugendLesser { util::compare(left, right) < 0 };
+	const tech::RuntimeArray<unsigned char> &greater = isAugendLesser ? right : left, &lesser = isAugendLesser ? left : right;
+	tech::RuntimeArray<unsigned char> tmp(std::max(left.length(), right.length()));
+	std::copy(greater.begin(), greater.end(), tmp.begin());
+	tmp -= lesser;
+	return fromMagnitude(tmp, isAugendLesser ? isAddendNegative : augend.isNegative());
+}
+
+Pointer<Integer> Integer::getSignedProduct(const Integer &multiplicand, const Integer &multiplier){
+	using namespace util;
+	const tech::RuntimeArray<unsigned char> &left = multiplicand.getArray(), &right = multiplier.getArray();
+	tech::RuntimeArray<unsigned char> tmp(left.length() + right.length());
+	std::copy(left.begin(), left.end(), tmp.begin());
+	if(&multiplicand == &multiplier) square(tmp);
+	else tmp *= right;
+	return fromMagnitude(tmp, multiplicand.isNegative() != multiplier.isNegative());
+}
+
+Pointer<Integer> Integer::getDifferenceOf(const Integer &minuend, const Integer &subtrahend){
+	return getSignedSum(minuend, subtrahend, true);
+}
+
+unsigned long long Integer::getLowestSetBit() const noexcept{
+	unsigned long long i { 0 };
+	while(i < getArray().length() && !getArray()[i]) ++i;
+	if(i == getArray().length()) return 0;
+	unsigned long long position { 8 * i };
+	for(unsigned char byte = getArray()[i]; !(byte & 1); byte >>= 1) ++position;
+	return position;
+}
+
+unsigned long long Integer::getBitLength() const{
+	unsigned long long i { getArray().length() };
+	while(i > 0 && !getArray()[i - 1]) --i;
+	if(!i) return 0;
+	unsigned long long length { 8 * (i - 1) };
+	for(unsigned char byte = getArray()[i - 1]; byte; byte >>= 1) ++length;
+	return length;
+}
+
+long long Integer::getAsLongLong() const noexcept{
+	unsigned long long value { 0 };
+	for(unsigned long long i = std::min<unsigned long long>(getArray().length(), 8); i-- > 0;){
+		value = (value << 8) | getArray()[i];
+	}
+	//negation modulo 2^64 gives bits of two's complement
+	return static_cast<long long>(isNegative() ? 0 - value : value);
+}
+
+Pointer<Integer> Integer::getSmallQuotient(unsigned long long divisor) const{
+	if(!divisor) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
+	tech::RuntimeArray<unsigned char> magnitude = getArray();
+	util::divmodSmall(magnitude, divisor);
+	return fromMagnitude(magnitude, isNegative());
+}
+
+unsigned long long Integer::getSmallRemainder(unsigned long long divisor) const{
+	if(!divisor) REPORT_ERROR(std::exception("Division by zero exception"), 0);
+	return util::modSmall(getArray(), divisor);
+}
+
+Pointer<Integer> Integer::fromLittleEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned){
+	if(!asSigned) return Unsigned::fromLittleEndianArray(array);
+	else{
+		if(array[array.length() - 1] & 0x80) return Signed::fromLittleEndianArray(array);
+		else return Unsigned::fromLittleEndianArray(array);
+	}
+}
+
+Pointer<Integer> Integer::fromBigEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned){
+	if(!asSigned) return Unsigned::fromBigEndianArray(array);
+	else{
+		if(array[array.length() - 1] & 0x80) return Signed::fromBigEndianArray(array);
+		else return Unsigned::fromBigEndianArray(array);
+	}
+}
+
+Pointer<Integer> Integer::fromBinaryInString(const std::string &binary){
+	if(binary[0] == '-') return Signed::fromBinaryInString(binary);
+	else{
+		if(binary[0] == '+') return Unsigned::fromBinaryInString(binary.substr(1, binary.length() - 1));
+		else return Unsigned::fromBinaryInString(binary);
+	}
+}
+
+Pointer<Integer> Integer::fromOctalInString(const std::string &octal){
+	if(octal[0] == '-') return Signed::fromOctalInString(octal);
+	else{
+		if(octal[0] == '+') return Unsigned::fromOctalInString(octal.substr(1, octal.length() - 1));
+		else return Unsigned::fromOctalInString(octal);
+	}
+}
+
+Pointer<Integer> Integer::fromDecimalInString(const std::string &decimal){
+	if(decimal[0] == '-') return Signed::fromDecimalInString(decimal);
+	else{
+		if(decimal[0] == '+') return Unsigned::fromDecimalInString(decimal.substr(1, decimal.length() - 1));
+		else return Unsigned::fromDecimalInString(decimal);
+	}
+}
+
+Pointer<Integer> Integer::fromHexadecimalInString(const std::string &hex){
+	if(hex[0] == '-') return Signed::fromHexadecimalInString(hex);
+	else{
+		if(hex[0] == '+') return Unsigned::fromHexadecimalInString(hex.substr(1, hex.length() - 1));
+		else return Unsigned::fromHexadecimalInString(hex);
+	}
+}
+
+}/* namespace numb */
+} /* namespace coma */
@@ -1,157 +1,352 @@
-/*
- * Integer.h
- *
- *  Created on: 24 cze 2015
- *      Author: Bartosz Miera
- */
-
-#ifndef NUMBERS_INTEGER_H_
-#define NUMBERS_INTEGER_H_
-
-#include "RealNumber.h"
-#include "IntegerArithmetic.h"
-#include "../Technical/RuntimeArray.h"
-
-namespace coma {
-namespace numb {
-
-/**
- * @brief
- * 	Enum defining if array of bytes stores number in little- or big-endian manner
- */
-enum class Endianess{
-	Little,//!< Little little-endian form
-	Big    //!< Big big-endian form
-};
-
-class Unsigned;
-class Signed;
-
-/**
- * @brief
- * 	Abstract class representing any type of integer.
- */
-class Integer:
-		public RealNumber,
-		public IntegerArithmetic<Pointer<Integer>>,
-		public IntegerArithmetic<Pointer<Unsigned>, Pointer<Integer>>,
-		public IntegerArithmetic<Pointer<Signed>, Pointer<Integer>>{
-public:
-	/**
-	 * @brief
-	 * 	Creates Integer from given array.
-	 *
-	 * @param array
-	 * 	Array representing number in 256-based number system. The number is stored in little-endian manner.
-	 *
-	 * @param asSigned
-	 * 	Tells if array should be interpreted as singed or unsigned number.
-	 *
-	 * @return
-	 * 	New Integer based on passed array.
-	 */
-	static Pointer<Integer> fromLittleEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned = false);
-
-	/**
-	 * @brief
-	 * 	Creates Integer from given array.
-	 *
-	 * @param array
-	 * 	Array representing number in 256-based number system. The number is stored in big-endian manner.
-	 *
-	 * @param asSigned
-	 * 	Tells if array should be interpreted as singed or unsigned number.
-	 *
-	 * @return
-	 * 	New Integer based on passed array.
-	 */
-	static Pointer<Integer> fromBigEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned = false);
-
-	/**
-	 * @brief
-	 * 	Creates Integer containing given number.
-	 *
-	 * @param binary
-	 * 	Binary number in string.
-	 *
-	 * @return
-	 * 	New Integer based on given number in string.
-	 */
-	static Pointer<Integer> fromBinaryInString(const std::string &binary);
-
-	/**
-	 * @brief
-	 * 	Creates Integer containing given number.
-	 *
-	 * @param octal
-	 * 	Octal number in string.
-	 *
-	 * @return
-	 * 	New Integer based on given number in string.
-	 */
-	static Pointer<Integer> fromOctalInString(const std::string &octal);
-
-	/**
-	 * @brief
-	 * 	Creates Integer containing given number.
-	 *
-	 * @param decimal
-	 * 	Decimal number in string.
-	 *
-	 * @return
-	 * 	New Integer based on given number in string.
-	 */
-	static Pointer<Integer> fromDecimalInString(const std::string &decimal);
-
-	/**
-	 * @brief
-	 * 	Creates Integer containing given number.
-	 *
-	 * @param hex
-	 * 	Hexadecimal number in string.
-	 *
-	 * @return
-	 * 	New Integer based on given number in string.
-	 */
-	static Pointer<Integer> fromHexadecimalInString(const std::string &hex);
-
-	/**
-	 * @brief
-	 * 	Default virtual destructor.
-	 */
-	virtual ~Integer() noexcept = default;
-
-protected:
-	/**
-	 * @brief
-	 * 	Constructs Integer from array of unsigned chars.
-	 *
-	 * @param numbersArray
-	 *	Array of bytes containing long number.
-
-	 * @param endianess
-	 * 	Defines if given number in array uses big- or little-endian notation.
-	 */
-	explicit Integer(const tech::RuntimeArray<unsigned char> &numbersArray, const Endianess endianess = Endianess::Little);
-
-	/**
-	 * @brief
-	 * 	Array getter.
-	 *
-	 * @return
-	 * 	Stored array.
-	 */
-	const tech::RuntimeArray<unsigned char> &getArray() const noexcept;
-
-private:
-	/**
-	 * @brief
-	 * 	Array storing very long integer.
-	 */
-	const tech::RuntimeArray<unsigned char> m_integer;
-};
-
-} /* namespace numb */
-} /* namespace coma */
-
-#endif /* NUMBERS_INTEGER_H_ */
+/*
+ * Integer.h
+ *
+ *  Created on: 24 cze 2015
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_INTEGER_H_
+#define NUMBERS_INTEGER_H_
+
+#include "RealNumber.h"
+#include "IntegerArithmetic.h"
+#include "../Technical/RuntimeArray.h"
+
+#include <memory>
+#include <vector>
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Enum defining if array of bytes stores number in little- or big-endian manner
+ */
+enum class Endianess{
+	Little,//!< Little little-endian form
+	Big    //!< Big big-endian form
+};
+
+class Unsigned;
+class Signed;
+class BarrettReducer;
+class BinaryFloat;
+class IntegerBatch;
+class IntegerAccumulator;
+class MontgomeryArithmetic;
+template<std::size_t Bits>
+class FixedUnsigned;
+template<std::size_t Bits>
+class FixedSigned;
+
+/**
+ * @brief
+ * 	Abstract class representing any type of integer.
+ */
+class Integer:
+		public RealNumber,
+		public IntegerArithmetic<Pointer<Integer>>,
+		public IntegerArithmetic<Pointer<Unsigned>, Pointer<Integer>>,
+		public IntegerArithmetic<Pointer<Signed>, Pointer<Integer>>{
+	friend class BarrettReducer;
+	friend class BinaryFloat;
+	friend class IntegerBatch;
+	friend class IntegerAccumulator;
+	friend class MontgomeryArithmetic;
+	template<std::size_t Bits>
+	friend class FixedUnsigned;
+	template<std::size_t Bits>
+	friend class FixedSigned;
+	friend Pointer<Integer> getSumOf(const std::vector<Pointer<Integer>> &numbers);
+public:
+	/**
+	 * @brief
+	 * 	Creates Integer from given array.
+	 *
+	 * @param array
+	 * 	Array representing number in 256-based number system. The number is stored in little-endian manner.
+	 *
+	 * @param asSigned
+	 * 	Tells if array should be interpreted as singed or unsigned number.
+	 *
+	 * @return
+	 * 	New Integer based on passed array.
+	 */
+	static Pointer<Integer> fromLittleEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned = false);
+
+	/**
+	 * @brief
+	 * 	Creates Integer from given array.
+	 *
+	 * @param array
+	 * 	Array representing number in 256-based number system. The number is stored in big-endian manner.
+	 *
+	 * @param asSigned
+	 * 	Tells if array should be interpreted as singed or unsigned number.
+	 *
+	 * @return
+	 * 	New Integer based on passed array.
+	 */
+	static Pointer<Integer> fromBigEndianArray(const tech::RuntimeArray<unsigned char> &array, bool asSigned = false);
+
+	/**
+	 * @brief
+	 * 	Creates Integer containing given number.
+	 *
+	 * @param binary
+	 * 	Binary number in string.
+	 *
+	 * @return
+	 * 	New Integer based on given number in string.
+	 */
+	static Pointer<Integer> fromBinaryInString(const std::string &binary);
+
+	/**
+	 * @brief
+	 * 	Creates Integer containing given number.
+	 *
+	 * @param octal
+	 * 	Octal number in string.
+	 *
+	 * @return
+	 * 	New Integer based on given number in string.
+	 */
+	static Pointer<Integer> fromOctalInString(const std::string &octal);
+
+	/**
+	 * @brief
+	 * 	Creates Integer containing given number.
+	 *
+	 * @param decimal
+	 * 	Decimal number in string.
+	 *
+	 * @return
+	 * 	New Integer based on given number in string.
+	 */
+	static Pointer<Integer> fromDecimalInString(const std::string &decimal);
+
+	/**
+	 * @brief
+	 * 	Creates Integer containing given number.
+	 *
+	 * @param hex
+	 * 	Hexadecimal number in string.
+	 *
+	 * @return
+	 * 	New Integer based on given number in string.
+	 */
+	static Pointer<Integer> fromHexadecimalInString(const std::string &hex);
+
+	/**
+	 * @brief
+	 * 	Default virtual destructor.
+	 */
+	virtual ~Integer() noexcept = default;
+
+	virtual bool isInteger() const noexcept override final;
+
+	/**
+	 * @brief
+	 * 	Checks if absolute value of @c *this is a power of two.
+	 *
+	 * @return
+	 * 	True if absolute value of stored number equals 2^n for some n. Else returns false.
+	 */
+	bool isPowerOfTwo() const;
+
+	/**
+	 * @brief
+	 * 	Finds position of the lowest set bit.
+	 *
+	 * @details
+	 * 	Position is the same for number and its negation. For zero 0 is returned.
+	 *
+	 * @return
+	 * 	Number of trailing zero bits of stored number.
+	 */
+	unsigned long long getLowestSetBit() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Counts significant bits of absolute value of stored number.
+	 *
+	 * @return
+	 * 	Position of the highest set bit of absolute value increased by one. For zero 0 is returned.
+	 */
+	unsigned long long getBitLength() const;
+
+	/**
+	 * @brief
+	 * 	Gets stored value as built-in integer.
+	 *
+	 * @details
+	 * 	Only 64 least significant bits of the number are taken into account, so values which do not fit in
+	 * 	long long are truncated like in conversion of 2-complement numbers.
+	 *
+	 * @return
+	 * 	Stored value modulo 2^64.
+	 */
+	long long getAsLongLong() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Divides stored number by single word divisor.
+	 *
+	 * @details
+	 * 	Uses util::divmodSmall(), which is much faster than general division.
+	 *
+	 * @param divisor
+	 * 	Non-zero divisor.
+	 *
+	 * @return
+	 * 	@c *this / @a divisor rounded towards zero.
+	 */
+	Pointer<Integer> getSmallQuotient(unsigned long long divisor) const;
+
+	/**
+	 * @brief
+	 * 	Finds remainder of division of absolute value by single word divisor.
+	 *
+	 * @details
+	 * 	Uses util::modSmall(), so no temporary Integer is created.
+	 *
+	 * @param divisor
+	 * 	Non-zero divisor.
+	 *
+	 * @return
+	 * 	|@c *this| mod @a divisor.
+	 */
+	unsigned long long getSmallRemainder(unsigned long long divisor) const;
+
+	/**
+	 * @brief
+	 * 	Shifts stored number left by given amount of bits.
+	 *
+	 * @param bits
+	 * 	Number of bits to shift.
+	 *
+	 * @return
+	 * 	@c *this * 2^@a bits.
+	 */
+	virtual Pointer<Integer> getShiftedLeft(unsigned long long bits) const = 0;
+
+	/**
+	 * @brief
+	 * 	Shifts stored number right by given amount of bits.
+	 *
+	 * @details
+	 * 	Result is rounded towards negative infinity, like arithmetic shift of 2-complement number.
+	 *
+	 * @param bits
+	 * 	Number of bits to shift.
+	 *
+	 * @return
+	 * 	floor(@c *this / 2^@a bits).
+	 */
+	virtual Pointer<Integer> getShiftedRight(unsigned long long bits) const = 0;
+
+protected:
+	/**
+	 * @brief
+	 * 	Constructs Integer from array of unsigned chars.
+	 *
+	 * @param numbersArray
+	 *	Array of bytes containing long number.
+
+	 * @param endianess
+	 * 	Defines if given number in array uses big- or little-endian notation.
+	 */
+	explicit Integer(const tech::RuntimeArray<unsigned char> &numbersArray, const Endianess endianess = Endianess::Little);
+
+	/**
+	 * @brief
+	 * 	Array getter.
+	 *
+	 * @return
+	 * 	Stored array, holding absolute value of number. Sign is kept by derived classes.
+	 */
+	const tech::RuntimeArray<unsigned char> &getArray() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Creates Integer from absolute value and sign.
+	 *
+	 * @param magnitude
+	 * 	Array holding absolute value of number in little-endian manner.
+	 *
+	 * @param isNegative
+	 * 	Tells if number is negative.
+	 *
+	 * @return
+	 * 	New Signed if number is negative, else new Unsigned.
+	 */
+	static Pointer<Integer> fromMagnitude(const tech::RuntimeArray<unsigned char> &magnitude, bool isNegative);
+
+	/**
+	 * @brief
+	 * 	Adds or subtracts Integers in one pass over their arrays.
+	 *
+	 * @details
+	 * 	Absolute values are added if effective signs of operands are equal. Else the lesser one is subtracted
+	 * 	from the greater one, which gives the sign of result.
+	 *
+	 * @param augend
+	 * 	First operand.
+	 *
+	 * @param addend
+	 * 	Second operand.
+	 *
+	 * @param isSubtraction
+	 * 	Tells if @a addend is subtracted instead of added.
+	 *
+	 * @return
+	 * 	@a augend + @a addend, or @a augend - @a addend if @a isSubtraction is true.
+	 */
+	static Pointer<Integer> getSignedSum(const Integer &augend, const Integer &addend, bool isSubtraction);
+
+	/**
+	 * @brief
+	 * 	Multiplies Integers of any signs.
+	 *
+	 * @details
+	 * 	Absolute values are multiplied, squaring them if both operands are the same object, and sign of result
+	 * 	is found from signs of operands.
+	 *
+	 * @param multiplicand
+	 * 	First factor.
+	 *
+	 * @param multiplier
+	 * 	Second factor.
+	 *
+	 * @return
+	 * 	@a multiplicand * @a multiplier.
+	 */
+	static Pointer<Integer> getSignedProduct(const Integer &multiplicand, const Integer &multiplier);
+
+	/**
+	 * @brief
+	 * 	Subtracts Integers in one pass over their arrays.
+	 *
+	 * @param minuend
+	 * 	Integer from which @a subtrahend is subtracted.
+	 *
+	 * @param subtrahend
+	 * 	Integer to subtract.
+	 *
+	 * @return
+	 * 	@a minuend - @a subtrahend.
+	 */
+	static Pointer<Integer> getDifferenceOf(const Integer &minuend, const Integer &subtrahend);
+
+private:
+	/**
+	 * @brief
+	 * 	Array storing absolute value of very long integer, shared by Integers of equal absolute values.
+	 */
+	const std::shared_ptr<const tech::RuntimeArray<unsigned char>> m_integer;
+};
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_INTEGER_H_ */
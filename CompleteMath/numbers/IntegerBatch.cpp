@@ -0,0 +1,341 @@
+/*
+ * IntegerBatch.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "IntegerBatch.h"
+
+#include "../Technical/Concurrency.h"
+#include "../Technical/TaskGroup.h"
+#include "../Utility/ArrayArithmetic.h"
+#include "../Utility/LaneArithmetic.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace coma {
+namespace numb {
+
+namespace{
+
+/**
+ * @brief
+ * 	Minimal number of words of all results, for which batch is split into chunks processed in parallel.
+ */
+const std::size_t PARALLEL_THRESHOLD { 1 << 14 };
+
+/**
+ * @brief
+ * 	Maximal length in words of magnitudes of numbers processed with lane kernels.
+ */
+const std::size_t LANE_WIDTH_LIMIT { 8 };
+
+/**
+ * @brief
+ * 	Minimal number of pairs processed with lane kernels.
+ */
+const std::size_t LANE_THRESHOLD { 16 };
+
+/**
+ * @brief
+ * 	Finds length of number without leading zero words.
+ *
+ * @param words
+ * 	Little-endian words of number.
+ *
+ * @param length
+ * 	Number of words.
+ *
+ * @return
+ * 	Number of significant words, zero for zero.
+ */
+std::size_t getSignificantLength(const unsigned long long *words, std::size_t length){
+	while(length && !words[length - 1]) --length;
+	return length;
+}
+
+/**
+ * @brief
+ * 	Compares magnitudes of numbers.
+ *
+ * @param lhs
+ * 	Little-endian words of first number.
+ *
+ * @param lhsLength
+ * 	Number of significant words of @a lhs.
+ *
+ * @param rhs
+ * 	Little-endian words of second number.
+ *
+ * @param rhsLength
+ * 	Number of significant words of @a rhs.
+ *
+ * @return
+ * 	True if @a lhs is lesser than @a rhs. Else returns false.
+ */
+bool isLesser(const unsigned long long *lhs, std::size_t lhsLength, const unsigned long long *rhs, std::size_t rhsLength){
+	if(lhsLength != rhsLength) return lhsLength < rhsLength;
+	for(std::size_t i = lhsLength; i-- > 0;){
+		if(lhs[i] != rhs[i]) return lhs[i] < rhs[i];
+	}
+	return false;
+}
+
+}
+
+IntegerBatch::IntegerBatch() :
+		m_words{},
+		m_offsets(1, 0),
+		m_isNegative{}{
+}
+
+IntegerBatch::IntegerBatch(const std::vector<Pointer<Integer>> &numbers) :
+		m_words{},
+		m_offsets(1, 0),
+		m_isNegative{}{
+	for(const auto &number : numbers){
+		if(!number){
+			REPORT_CONSTRUCTOR_ERROR(std::exception("Null pointer exception"), *this = IntegerBatch());
+		}
+		m_offsets.push_back(m_offsets.back() + (number->getArray().length() + 7) / 8);
+	}
+	m_words.resize(m_offsets.back());
+	m_isNegative.resize(numbers.size());
+	for(std::size_t i = 0; i < numbers.size(); ++i){
+		const tech::RuntimeArray<unsigned char> &array = numbers[i]->getArray();
+		m_isNegative[i] = numbers[i]->isNegative() ? 1 : 0;
+		for(unsigned long long j = 0; j < array.length(); ++j){
+			m_words[m_offsets[i] + j / 8] |= static_cast<unsigned long long>(array[j]) << (8 * (j % 8));
+		}
+	}
+}
+
+std::size_t IntegerBatch::getSize() const noexcept{
+	return m_isNegative.size();
+}
+
+Pointer<Integer> IntegerBatch::getInteger(std::size_t index) const{
+	if(index >= getSize()) REPORT_ERROR(std::exception("Index out of range exception"), nullptr);
+	const unsigned long long *words { m_words.data() + m_offsets[index] };
+	std::size_t length { getSignificantLength(words, getLength(index)) };
+	//zero has one byte
+	tech::RuntimeArray<unsigned char> array(std::max<std::size_t>(8 * length, 1));
+	for(std::size_t i = 0; i < 8 * length; ++i) array[i] = static_cast<unsigned char>(words[i / 8] >> (8 * (i % 8)));
+	return Integer::fromMagnitude(array, m_isNegative[index] != 0);
+}
+
+std::vector<Pointer<Integer>> IntegerBatch::getIntegers() const{
+	std::vector<Pointer<Integer>> numbers;
+	numbers.reserve(getSize());
+	for(std::size_t i = 0; i < getSize(); ++i) numbers.push_back(getInteger(i));
+	return numbers;
+}
+
+IntegerBatch IntegerBatch::getSums(const IntegerBatch &toAdd) const{
+	if(getSize() != toAdd.getSize()){
+		REPORT_ERROR(std::exception("Different sizes of batches exception"), IntegerBatch());
+	}
+	std::size_t width { getLaneWidth(toAdd) };
+	if(width){
+		std::vector<unsigned long long> lanes = getLanes(width);
+		util::addLanes(lanes.data(), toAdd.getLanes(width).data(), lanes.data(), width, getSize());
+		return fromLanes(lanes, width);
+	}
+	std::vector<std::size_t> lengths(getSize());
+	for(std::size_t i = 0; i < getSize(); ++i) lengths[i] = std::max(getLength(i), toAdd.getLength(i)) + 1;
+	return apply(toAdd, lengths, add);
+}
+
+IntegerBatch IntegerBatch::getProducts(const IntegerBatch &toMultiply) const{
+	if(getSize() != toMultiply.getSize()){
+		REPORT_ERROR(std::exception("Different sizes of batches exception"), IntegerBatch());
+	}
+	std::vector<std::size_t> lengths(getSize());
+	for(std::size_t i = 0; i < getSize(); ++i) lengths[i] = getLength(i) + toMultiply.getLength(i);
+	return apply(toMultiply, lengths, multiply);
+}
+
+IntegerBatch IntegerBatch::getDifferences(const IntegerBatch &toSubtract) const{
+	if(getSize() != toSubtract.getSize()){
+		REPORT_ERROR(std::exception("Different sizes of batches exception"), IntegerBatch());
+	}
+	std::size_t width { getLaneWidth(toSubtract) };
+	if(width){
+		std::vector<unsigned long long> lanes = getLanes(width);
+		util::subtractLanes(lanes.data(), toSubtract.getLanes(width).data(), lanes.data(), width, getSize());
+		return fromLanes(lanes, width);
+	}
+	std::vector<std::size_t> lengths(getSize());
+	for(std::size_t i = 0; i < getSize(); ++i) lengths[i] = std::max(getLength(i), toSubtract.getLength(i)) + 1;
+	return apply(toSubtract, lengths, subtract);
+}
+
+std::vector<CompareResult> IntegerBatch::getComparisons(const IntegerBatch &toCompare) const{
+	if(getSize() != toCompare.getSize()){
+		REPORT_ERROR(std::exception("Different sizes of batches exception"), std::vector<CompareResult>());
+	}
+	std::vector<CompareResult> results(getSize());
+	std::size_t width { getLaneWidth(toCompare) };
+	if(width){
+		std::vector<signed char> signs(getSize());
+		util::compareLanes(getLanes(width).data(), toCompare.getLanes(width).data(), signs.data(), width, getSize());
+		for(std::size_t i = 0; i < getSize(); ++i) results[i] = static_cast<CompareResult>(signs[i]);
+		return results;
+	}
+	for(std::size_t i = 0; i < getSize(); ++i){
+		const unsigned long long
+			*left { m_words.data() + m_offsets[i] },
+			*right { toCompare.m_words.data() + toCompare.m_offsets[i] };
+		std::size_t
+			leftLength { getSignificantLength(left, getLength(i)) },
+			rightLength { getSignificantLength(right, toCompare.getLength(i)) };
+		if(m_isNegative[i] != toCompare.m_isNegative[i]){
+			results[i] = m_isNegative[i] ? CompareResult::ThisLesser : CompareResult::ThisGreater;
+		}else if(isLesser(left, leftLength, right, rightLength)){
+			results[i] = m_isNegative[i] ? CompareResult::ThisGreater : CompareResult::ThisLesser;
+		}else if(isLesser(right, rightLength, left, leftLength)){
+			results[i] = m_isNegative[i] ? CompareResult::ThisLesser : CompareResult::ThisGreater;
+		}else{
+			results[i] = CompareResult::Equal;
+		}
+	}
+	return results;
+}
+
+void IntegerBatch::add(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result){
+	addSigned(lhs, rhs, index, result, false);
+}
+
+void IntegerBatch::subtract(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result){
+	addSigned(lhs, rhs, index, result, true);
+}
+
+void IntegerBatch::addSigned(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result,
+		bool isSubtraction){
+	const unsigned long long
+		*left { lhs.m_words.data() + lhs.m_offsets[index] },
+		*right { rhs.m_words.data() + rhs.m_offsets[index] };
+	std::size_t
+		leftLength { getSignificantLength(left, lhs.getLength(index)) },
+		rightLength { getSignificantLength(right, rhs.getLength(index)) };
+	bool isLeftNegative { lhs.m_isNegative[index] != 0 }, isRightNegative { (rhs.m_isNegative[index] != 0) != isSubtraction };
+	//the greater magnitude goes first, so it determines sign and nothing is borrowed past its end
+	if(isLesser(left, leftLength, right, rightLength)){
+		std::swap(left, right);
+		std::swap(leftLength, rightLength);
+		std::swap(isLeftNegative, isRightNegative);
+	}
+	unsigned long long *sum { result.m_words.data() + result.m_offsets[index] };
+	std::copy(left, left + leftLength, sum);
+	if(isLeftNegative == isRightNegative){
+		unsigned long long carry { util::addWords(sum, right, rightLength) };
+		for(std::size_t i = rightLength; carry; ++i){
+			sum[i] += carry;
+			carry = sum[i] < carry ? 1 : 0;
+		}
+	}else{
+		unsigned long long borrow { util::subtractWords(sum, right, rightLength) };
+		for(std::size_t i = rightLength; borrow; ++i) borrow = sum[i]-- ? 0 : 1;
+	}
+	result.m_isNegative[index] = isLeftNegative && getSignificantLength(sum, result.getLength(index)) ? 1 : 0;
+}
+
+void IntegerBatch::multiply(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result){
+	const unsigned long long
+		*left { lhs.m_words.data() + lhs.m_offsets[index] },
+		*right { rhs.m_words.data() + rhs.m_offsets[index] };
+	std::size_t
+		leftLength { getSignificantLength(left, lhs.getLength(index)) },
+		rightLength { getSignificantLength(right, rhs.getLength(index)) };
+	util::multiplyWordArrays(left, leftLength, right, rightLength, result.m_words.data() + result.m_offsets[index]);
+	bool isNegative { lhs.m_isNegative[index] != rhs.m_isNegative[index] };
+	result.m_isNegative[index] = isNegative && leftLength && rightLength ? 1 : 0;
+}
+
+IntegerBatch IntegerBatch::apply(const IntegerBatch &other, const std::vector<std::size_t> &lengths, Kernel kernel) const{
+	IntegerBatch result;
+	for(std::size_t length : lengths) result.m_offsets.push_back(result.m_offsets.back() + length);
+	//all results are allocated in one block
+	result.m_words.resize(result.m_offsets.back());
+	result.m_isNegative.resize(lengths.size());
+	auto process = [&](std::size_t begin, std::size_t end){
+		for(std::size_t i = begin; i < end; ++i) kernel(*this, other, i, result);
+	};
+	std::size_t chunks { std::min<std::size_t>(tech::getThreadCount(), lengths.size()) };
+	if(chunks < 2 || result.m_words.size() < PARALLEL_THRESHOLD){
+		process(0, lengths.size());
+		return result;
+	}
+	//chunks have similar numbers of words of results
+	std::vector<std::size_t> bounds(1, 0);
+	for(std::size_t i = 1; i < chunks; ++i){
+		std::size_t words { result.m_words.size() / chunks * i };
+		bounds.push_back(std::lower_bound(result.m_offsets.begin(), result.m_offsets.end() - 1, words) - result.m_offsets.begin());
+	}
+	bounds.push_back(lengths.size());
+	tech::TaskGroup group;
+	for(std::size_t i = 1; i < chunks; ++i) group.fork([&, i](){ process(bounds[i], bounds[i + 1]); });
+	process(bounds[0], bounds[1]);
+	group.join();
+	return result;
+}
+
+IntegerBatch IntegerBatch::fromLanes(const std::vector<unsigned long long> &lanes, std::size_t width){
+	IntegerBatch result;
+	std::size_t count { lanes.size() / width };
+	result.m_words.resize(lanes.size());
+	result.m_isNegative.resize(count);
+	for(std::size_t i = 0; i < count; ++i){
+		result.m_offsets.push_back((i + 1) * width);
+		bool isNegative { (lanes[(width - 1) * count + i] >> 63) != 0 };
+		result.m_isNegative[i] = isNegative ? 1 : 0;
+		//magnitude of negative number is its inverted words plus one
+		unsigned long long carry { isNegative ? 1ull : 0ull };
+		for(std::size_t j = 0; j < width; ++j){
+			unsigned long long word { (isNegative ? ~lanes[j * count + i] : lanes[j * count + i]) + carry };
+			carry = word < carry ? 1 : 0;
+			result.m_words[i * width + j] = word;
+		}
+	}
+	return result;
+}
+
+std::vector<unsigned long long> IntegerBatch::getLanes(std::size_t width) const{
+	std::vector<unsigned long long> lanes(width * getSize());
+	for(std::size_t i = 0; i < getSize(); ++i){
+		const unsigned long long *words { m_words.data() + m_offsets[i] };
+		std::size_t length { getSignificantLength(words, getLength(i)) };
+		unsigned long long carry { m_isNegative[i] ? 1ull : 0ull };
+		for(std::size_t j = 0; j < width; ++j){
+			unsigned long long word { j < length ? words[j] : 0 };
+			if(m_isNegative[i]){
+				word = ~word + carry;
+				carry = word < carry ? 1 : 0;
+			}
+			lanes[j * getSize() + i] = word;
+		}
+	}
+	return lanes;
+}
+
+std::size_t IntegerBatch::getLaneWidth(const IntegerBatch &other) const{
+	if(getSize() < LANE_THRESHOLD) return 0;
+	std::size_t width { 0 };
+	for(std::size_t i = 0; i < getSize(); ++i){
+		std::size_t length = std::max(getSignificantLength(m_words.data() + m_offsets[i], getLength(i)),
+				getSignificantLength(other.m_words.data() + other.m_offsets[i], other.getLength(i)));
+		if(length > LANE_WIDTH_LIMIT) return 0;
+		width = std::max(width, length);
+	}
+	//one more word for carry and sign
+	return width + 1;
+}
+
+std::size_t IntegerBatch::getLength(std::size_t index) const noexcept{
+	return m_offsets[index + 1] - m_offsets[index];
+}
+
+} /* namespace numb */
+} /* namespace coma */
@@ -0,0 +1,269 @@
+/*
+ * IntegerBatch.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_INTEGERBATCH_H_
+#define NUMBERS_INTEGERBATCH_H_
+
+#include "Integer.h"
+
+#include <vector>
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Sequence of Integers for arithmetic on many independent pairs of operands.
+ *
+ * @details
+ * 	Numbers are stored in structure of arrays: magnitudes of all of them as 64 bit words in one block, offsets
+ * 	of numbers in the block and their signs. Operations on batches work directly on the block, without virtual
+ * 	dispatch and without creating Integers, and allocate whole result at once. Long batches are split into
+ * 	chunks processed in parallel. Integers are created only when they are taken from batch.
+ *
+ * 	Additions, subtractions and comparisons of many numbers not longer than 512 bits are done in transposed
+ * 	two's complement layout with lane kernels, which process several numbers at once in vector registers.
+ */
+class IntegerBatch {
+public:
+	/**
+	 * @brief
+	 * 	Creates empty batch.
+	 */
+	IntegerBatch();
+
+	/**
+	 * @brief
+	 * 	Copies given Integers to batch.
+	 *
+	 * @param numbers
+	 * 	Integers, none of them null.
+	 */
+	explicit IntegerBatch(const std::vector<Pointer<Integer>> &numbers);
+
+	/**
+	 * @brief
+	 * 	Size getter.
+	 *
+	 * @return
+	 * 	Number of Integers in batch.
+	 */
+	std::size_t getSize() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Creates Integer from batch.
+	 *
+	 * @param index
+	 * 	Index of number, lesser than getSize().
+	 *
+	 * @return
+	 * 	Number at @a index.
+	 */
+	Pointer<Integer> getInteger(std::size_t index) const;
+
+	/**
+	 * @brief
+	 * 	Creates all Integers from batch.
+	 *
+	 * @return
+	 * 	Numbers in order of batch.
+	 */
+	std::vector<Pointer<Integer>> getIntegers() const;
+
+	/**
+	 * @brief
+	 * 	Adds numbers of two batches pairwise.
+	 *
+	 * @param toAdd
+	 * 	Batch of the same size.
+	 *
+	 * @return
+	 * 	Batch of sums of numbers with equal indices.
+	 */
+	IntegerBatch getSums(const IntegerBatch &toAdd) const;
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers of two batches pairwise.
+	 *
+	 * @param toMultiply
+	 * 	Batch of the same size.
+	 *
+	 * @return
+	 * 	Batch of products of numbers with equal indices.
+	 */
+	IntegerBatch getProducts(const IntegerBatch &toMultiply) const;
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers of two batches pairwise.
+	 *
+	 * @param toSubtract
+	 * 	Batch of the same size.
+	 *
+	 * @return
+	 * 	Batch of differences of numbers with equal indices.
+	 */
+	IntegerBatch getDifferences(const IntegerBatch &toSubtract) const;
+
+	/**
+	 * @brief
+	 * 	Compares numbers of two batches pairwise.
+	 *
+	 * @param toCompare
+	 * 	Batch of the same size.
+	 *
+	 * @return
+	 * 	Results of comparisons of numbers of this batch with numbers of @a toCompare with equal indices.
+	 */
+	std::vector<CompareResult> getComparisons(const IntegerBatch &toCompare) const;
+
+private:
+	/**
+	 * @brief
+	 * 	Kernel computing result of one pair of operands.
+	 *
+	 * @details
+	 * 	Arguments are: left batch, right batch, index of pair and batch of results with reserved words.
+	 */
+	typedef void (*Kernel)(const IntegerBatch &, const IntegerBatch &, std::size_t, IntegerBatch &);
+
+	/**
+	 * @brief
+	 * 	Kernel of getSums().
+	 */
+	static void add(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result);
+
+	/**
+	 * @brief
+	 * 	Kernel of getProducts().
+	 */
+	static void multiply(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result);
+
+	/**
+	 * @brief
+	 * 	Kernel of getDifferences().
+	 */
+	static void subtract(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result);
+
+	/**
+	 * @brief
+	 * 	Adds pair of operands, one of them possibly negated.
+	 *
+	 * @param lhs
+	 * 	Left operands.
+	 *
+	 * @param rhs
+	 * 	Right operands.
+	 *
+	 * @param index
+	 * 	Index of pair.
+	 *
+	 * @param result
+	 * 	Batch of results with reserved words.
+	 *
+	 * @param isSubtraction
+	 * 	If true, right operand is subtracted instead of added.
+	 */
+	static void addSigned(const IntegerBatch &lhs, const IntegerBatch &rhs, std::size_t index, IntegerBatch &result,
+			bool isSubtraction);
+
+	/**
+	 * @brief
+	 * 	Creates batch from numbers in transposed layout of lane kernels.
+	 *
+	 * @param lanes
+	 * 	Two's complement numbers, word j of number i at index j * count + i.
+	 *
+	 * @param width
+	 * 	Number of words of every number.
+	 *
+	 * @return
+	 * 	Batch of the numbers.
+	 */
+	static IntegerBatch fromLanes(const std::vector<unsigned long long> &lanes, std::size_t width);
+
+	/**
+	 * @brief
+	 * 	Converts numbers to transposed layout of lane kernels.
+	 *
+	 * @param width
+	 * 	Number of words of every number, greater than length of every magnitude.
+	 *
+	 * @return
+	 * 	Two's complement numbers, word j of number i at index j * getSize() + i.
+	 */
+	std::vector<unsigned long long> getLanes(std::size_t width) const;
+
+	/**
+	 * @brief
+	 * 	Chooses width of numbers for lane kernels.
+	 *
+	 * @param other
+	 * 	Right operands, batch of the same size.
+	 *
+	 * @return
+	 * 	Number of words holding every sum or difference of pair in two's complement, or zero if batches are too
+	 * 	short or their numbers too long to use lane kernels.
+	 */
+	std::size_t getLaneWidth(const IntegerBatch &other) const;
+
+	/**
+	 * @brief
+	 * 	Applies kernel to all pairs of operands.
+	 *
+	 * @param other
+	 * 	Right operands, batch of the same size.
+	 *
+	 * @param lengths
+	 * 	Numbers of words reserved for results.
+	 *
+	 * @param kernel
+	 * 	Kernel computing one result.
+	 *
+	 * @return
+	 * 	Batch of results.
+	 */
+	IntegerBatch apply(const IntegerBatch &other, const std::vector<std::size_t> &lengths, Kernel kernel) const;
+
+	/**
+	 * @brief
+	 * 	Length getter.
+	 *
+	 * @param index
+	 * 	Index of number.
+	 *
+	 * @return
+	 * 	Number of words reserved for number at @a index, which may include leading zero words.
+	 */
+	std::size_t getLength(std::size_t index) const noexcept;
+
+	/**
+	 * @brief
+	 * 	Magnitudes of numbers, one after another, as little-endian 64 bit words.
+	 */
+	std::vector<unsigned long long> m_words;
+
+	/**
+	 * @brief
+	 * 	Offsets of numbers in @a m_words, with the end of the last number at the end.
+	 */
+	std::vector<std::size_t> m_offsets;
+
+	/**
+	 * @brief
+	 * 	Signs of numbers: one for negative and zero for others. Bytes are used instead of bits, so that results
+	 * 	of different chunks can be written in parallel.
+	 */
+	std::vector<unsigned char> m_isNegative;
+};
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_INTEGERBATCH_H_ */
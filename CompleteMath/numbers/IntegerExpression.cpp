@@ -0,0 +1,206 @@
+/*
+ * IntegerExpression.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "IntegerExpression.h"
+
+#include "Unsigned.h"
+#include "../Utility/ArrayArithmetic.h"
+
+#include <algorithm>
+
+namespace coma {
+namespace numb {
+
+namespace{
+
+/**
+ * @brief
+ * 	Buffer of sums given back by finished accumulators of current thread.
+ */
+thread_local std::vector<unsigned long long> sumArena;
+
+/**
+ * @brief
+ * 	Buffer of scratch words given back by finished accumulators of current thread.
+ */
+thread_local std::vector<unsigned long long> scratchArena;
+
+/**
+ * @brief
+ * 	Finds length of number without leading zero words.
+ *
+ * @param words
+ * 	Little-endian words of number.
+ *
+ * @param length
+ * 	Number of words.
+ *
+ * @return
+ * 	Number of significant words, zero for zero.
+ */
+std::size_t getSignificantLength(const unsigned long long *words, std::size_t length){
+	while(length && !words[length - 1]) --length;
+	return length;
+}
+
+/**
+ * @brief
+ * 	Compares magnitudes of numbers.
+ *
+ * @param lhs
+ * 	Little-endian words of first number.
+ *
+ * @param lhsLength
+ * 	Number of significant words of @a lhs.
+ *
+ * @param rhs
+ * 	Little-endian words of second number.
+ *
+ * @param rhsLength
+ * 	Number of significant words of @a rhs.
+ *
+ * @return
+ * 	True if @a lhs is lesser than @a rhs. Else returns false.
+ */
+bool isLesser(const unsigned long long *lhs, std::size_t lhsLength, const unsigned long long *rhs, std::size_t rhsLength){
+	if(lhsLength != rhsLength) return lhsLength < rhsLength;
+	for(std::size_t i = lhsLength; i-- > 0;){
+		if(lhs[i] != rhs[i]) return lhs[i] < rhs[i];
+	}
+	return false;
+}
+
+/**
+ * @brief
+ * 	Subtracts number from greater number, storing result in place of the lesser one.
+ *
+ * @param lhs
+ * 	Subtrahend, replaced with difference.
+ *
+ * @param rhs
+ * 	Minuend, not lesser than @a lhs.
+ *
+ * @param length
+ * 	Number of words of both numbers.
+ */
+void subtractFrom(unsigned long long *lhs, const unsigned long long *rhs, std::size_t length){
+	unsigned long long borrow { 0 };
+	for(std::size_t i = 0; i < length; ++i){
+		unsigned long long subtrahend { lhs[i] + borrow };
+		borrow = subtrahend < borrow || rhs[i] < subtrahend ? 1 : 0;
+		lhs[i] = rhs[i] - subtrahend;
+	}
+}
+
+}
+
+IntegerAccumulator::IntegerAccumulator() :
+		m_sum{},
+		m_isNegative{false},
+		m_scratch{}{
+	//accumulator nested in evaluation of other one finds arena empty
+	m_sum.swap(sumArena);
+	m_scratch.swap(scratchArena);
+	m_sum.clear();
+}
+
+IntegerAccumulator::~IntegerAccumulator() noexcept{
+	if(m_sum.capacity() > sumArena.capacity()) m_sum.swap(sumArena);
+	if(m_scratch.capacity() > scratchArena.capacity()) m_scratch.swap(scratchArena);
+}
+
+void IntegerAccumulator::addProduct(const std::vector<Pointer<Integer>> &factors, bool isNegative){
+	if(factors.empty()) REPORT_ERROR(std::exception("Empty range exception"), );
+	std::size_t total { 0 }, longest { 0 };
+	for(const auto &factor : factors){
+		if(!factor) REPORT_ERROR(std::exception("Null pointer exception"), );
+		if(factor->isZero()) return;
+		if(factor->isNegative()) isNegative = !isNegative;
+		total += getLength(factor);
+		longest = std::max(longest, getLength(factor));
+	}
+	//scratch holds current factor and two partial products, which are swapped after every multiplication
+	m_scratch.resize(longest + 2 * total);
+	unsigned long long
+		*factor { m_scratch.data() },
+		*product { factor + longest },
+		*next { product + total };
+	setMagnitude(factors.front(), product);
+	std::size_t length { getSignificantLength(product, getLength(factors.front())) };
+	for(std::size_t i = 1; i < factors.size(); ++i){
+		std::size_t factorLength { getLength(factors[i]) };
+		setMagnitude(factors[i], factor);
+		factorLength = getSignificantLength(factor, factorLength);
+		util::multiplyWordArrays(product, length, factor, factorLength, next);
+		length = getSignificantLength(next, length + factorLength);
+		std::swap(product, next);
+	}
+	add(product, length, isNegative);
+}
+
+Pointer<Integer> IntegerAccumulator::getResult() const{
+	std::size_t length { getSignificantLength(m_sum.data(), m_sum.size()) };
+	//zero has one byte
+	tech::RuntimeArray<unsigned char> array(std::max<std::size_t>(8 * length, 1));
+	for(std::size_t i = 0; i < 8 * length; ++i) array[i] = static_cast<unsigned char>(m_sum[i / 8] >> (8 * (i % 8)));
+	return Integer::fromMagnitude(array, m_isNegative);
+}
+
+void IntegerAccumulator::add(const unsigned long long *words, std::size_t length, bool isNegative){
+	length = getSignificantLength(words, length);
+	if(!length) return;
+	std::size_t sumLength { getSignificantLength(m_sum.data(), m_sum.size()) };
+	if(!sumLength){
+		m_sum.assign(words, words + length);
+		m_isNegative = isNegative;
+		return;
+	}
+	m_sum.resize(sumLength);
+	if(isNegative == m_isNegative){
+		//one more word for carry
+		m_sum.resize(std::max(sumLength, length) + 1, 0);
+		unsigned long long carry { util::addWords(m_sum.data(), words, length) };
+		for(std::size_t i = length; carry; ++i) carry = ++m_sum[i] ? 0 : 1;
+	}else if(!isLesser(m_sum.data(), sumLength, words, length)){
+		unsigned long long borrow { util::subtractWords(m_sum.data(), words, length) };
+		for(std::size_t i = length; borrow; ++i) borrow = m_sum[i]-- ? 0 : 1;
+	}else{
+		m_sum.resize(length, 0);
+		subtractFrom(m_sum.data(), words, length);
+		m_isNegative = isNegative;
+	}
+}
+
+std::size_t IntegerAccumulator::getLength(Pointer<Integer> number){
+	return (number->getArray().length() + 7) / 8;
+}
+
+void IntegerAccumulator::setMagnitude(Pointer<Integer> number, unsigned long long *words){
+	const tech::RuntimeArray<unsigned char> &array = number->getArray();
+	std::fill(words, words + getLength(number), 0);
+	for(unsigned long long i = 0; i < array.length(); ++i){
+		words[i / 8] |= static_cast<unsigned long long>(array[i]) << (8 * (i % 8));
+	}
+}
+
+IntegerTerm::IntegerTerm(Pointer<Integer> value) :
+		m_value{value}{
+	if(!m_value){
+		REPORT_CONSTRUCTOR_ERROR(std::exception("Null pointer exception"), m_value = Number::ZERO());
+	}
+}
+
+void IntegerTerm::accumulate(IntegerAccumulator &accumulator, bool isNegative) const{
+	accumulator.addProduct(std::vector<Pointer<Integer>>(1, m_value), isNegative);
+}
+
+void IntegerTerm::appendFactors(std::vector<Pointer<Integer>> &factors) const{
+	factors.push_back(m_value);
+}
+
+} /* namespace numb */
+} /* namespace coma */
@@ -0,0 +1,507 @@
+/*
+ * IntegerExpression.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_INTEGEREXPRESSION_H_
+#define NUMBERS_INTEGEREXPRESSION_H_
+
+#include "Integer.h"
+
+#include <vector>
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Sum of signed products of Integers, computed on words of magnitudes.
+ *
+ * @details
+ * 	Every product is multiplied in scratch words and added to or subtracted from sum in place, so no Integer
+ * 	is created before the result. Buffers of sum and scratch are taken from thread local arena and given back
+ * 	to it after evaluation, so subsequent evaluations in the same thread reuse memory.
+ */
+class IntegerAccumulator {
+public:
+	/**
+	 * @brief
+	 * 	Creates zero sum, taking buffers from arena of current thread.
+	 */
+	IntegerAccumulator();
+
+	IntegerAccumulator(const IntegerAccumulator &) = delete;
+	IntegerAccumulator &operator=(const IntegerAccumulator &) = delete;
+
+	/**
+	 * @brief
+	 * 	Gives buffers back to arena of current thread.
+	 */
+	~IntegerAccumulator() noexcept;
+
+	/**
+	 * @brief
+	 * 	Adds product of Integers to sum.
+	 *
+	 * @param factors
+	 * 	Non-empty sequence of factors, none of them null.
+	 *
+	 * @param isNegative
+	 * 	If true, product is subtracted instead of added.
+	 */
+	void addProduct(const std::vector<Pointer<Integer>> &factors, bool isNegative);
+
+	/**
+	 * @brief
+	 * 	Creates Integer equal to sum.
+	 *
+	 * @return
+	 * 	Sum of all added products.
+	 */
+	Pointer<Integer> getResult() const;
+
+private:
+	/**
+	 * @brief
+	 * 	Adds signed magnitude to sum.
+	 *
+	 * @param words
+	 * 	Little-endian words of magnitude, outside of sum.
+	 *
+	 * @param length
+	 * 	Number of words.
+	 *
+	 * @param isNegative
+	 * 	If true, magnitude is subtracted instead of added.
+	 */
+	void add(const unsigned long long *words, std::size_t length, bool isNegative);
+
+	/**
+	 * @brief
+	 * 	Finds number of words of magnitude of Integer.
+	 *
+	 * @param number
+	 * 	Integer.
+	 *
+	 * @return
+	 * 	Number of words which fit magnitude of @a number.
+	 */
+	static std::size_t getLength(Pointer<Integer> number);
+
+	/**
+	 * @brief
+	 * 	Stores magnitude of Integer in words.
+	 *
+	 * @param number
+	 * 	Integer.
+	 *
+	 * @param words
+	 * 	Destination of getLength(@a number) little-endian words.
+	 */
+	static void setMagnitude(Pointer<Integer> number, unsigned long long *words);
+
+	/**
+	 * @brief
+	 * 	Little-endian words of magnitude of sum.
+	 */
+	std::vector<unsigned long long> m_sum;
+
+	/**
+	 * @brief
+	 * 	Sign of sum.
+	 */
+	bool m_isNegative;
+
+	/**
+	 * @brief
+	 * 	Words of factors and partial products.
+	 */
+	std::vector<unsigned long long> m_scratch;
+};
+
+/**
+ * @brief
+ * 	Base of nodes of Integer arithmetic expressions.
+ *
+ * @details
+ * 	Sums, differences and products of Integers written with operators build tree of nodes instead of being
+ * 	computed. Tree is evaluated at once with getValue(): sums and differences of products, like a*b + c*d - e,
+ * 	are accumulated into one buffer with IntegerAccumulator, without intermediate Integers and without
+ * 	negating subtrahends. Sums nested in products are evaluated separately.
+ *
+ * @tparam Derived
+ * 	Type of node.
+ */
+template<class Derived>
+class IntegerExpression {
+public:
+	/**
+	 * @brief
+	 * 	Evaluates expression.
+	 *
+	 * @return
+	 * 	Value of expression.
+	 */
+	Pointer<Integer> getValue() const{
+		IntegerAccumulator accumulator;
+		getDerived().accumulate(accumulator, false);
+		return accumulator.getResult();
+	}
+
+	/**
+	 * @brief
+	 * 	Node getter.
+	 *
+	 * @return
+	 * 	This node as its actual type.
+	 */
+	const Derived &getDerived() const noexcept{ return static_cast<const Derived &>(*this); }
+};
+
+/**
+ * @brief
+ * 	Leaf of expression, single Integer.
+ */
+class IntegerTerm : public IntegerExpression<IntegerTerm> {
+public:
+	/**
+	 * @brief
+	 * 	Creates leaf of given Integer.
+	 *
+	 * @param value
+	 * 	Integer, not null.
+	 */
+	explicit IntegerTerm(Pointer<Integer> value);
+
+	/**
+	 * @brief
+	 * 	Adds value to accumulator.
+	 *
+	 * @param accumulator
+	 * 	Accumulator of expression.
+	 *
+	 * @param isNegative
+	 * 	If true, value is subtracted instead of added.
+	 */
+	void accumulate(IntegerAccumulator &accumulator, bool isNegative) const;
+
+	/**
+	 * @brief
+	 * 	Appends value to factors of product.
+	 *
+	 * @param factors
+	 * 	Factors of product.
+	 */
+	void appendFactors(std::vector<Pointer<Integer>> &factors) const;
+
+private:
+	/**
+	 * @brief
+	 * 	Value of leaf.
+	 */
+	Pointer<Integer> m_value;
+};
+
+/**
+ * @brief
+ * 	Product of two expressions.
+ *
+ * @tparam Lhs
+ * 	Type of first factor.
+ *
+ * @tparam Rhs
+ * 	Type of second factor.
+ */
+template<class Lhs, class Rhs>
+class IntegerProduct : public IntegerExpression<IntegerProduct<Lhs, Rhs>> {
+public:
+	/**
+	 * @brief
+	 * 	Creates product node.
+	 *
+	 * @param lhs
+	 * 	First factor.
+	 *
+	 * @param rhs
+	 * 	Second factor.
+	 */
+	IntegerProduct(const Lhs &lhs, const Rhs &rhs) : m_lhs{lhs}, m_rhs{rhs}{}
+
+	/**
+	 * @brief
+	 * 	Adds product of all factors to accumulator.
+	 *
+	 * @param accumulator
+	 * 	Accumulator of expression.
+	 *
+	 * @param isNegative
+	 * 	If true, product is subtracted instead of added.
+	 */
+	void accumulate(IntegerAccumulator &accumulator, bool isNegative) const{
+		std::vector<Pointer<Integer>> factors;
+		appendFactors(factors);
+		accumulator.addProduct(factors, isNegative);
+	}
+
+	/**
+	 * @brief
+	 * 	Appends factors of both children to factors of product.
+	 *
+	 * @param factors
+	 * 	Factors of product.
+	 */
+	void appendFactors(std::vector<Pointer<Integer>> &factors) const{
+		m_lhs.appendFactors(factors);
+		m_rhs.appendFactors(factors);
+	}
+
+private:
+	/**
+	 * @brief
+	 * 	First factor.
+	 */
+	Lhs m_lhs;
+
+	/**
+	 * @brief
+	 * 	Second factor.
+	 */
+	Rhs m_rhs;
+};
+
+/**
+ * @brief
+ * 	Sum or difference of two expressions.
+ *
+ * @tparam Lhs
+ * 	Type of first operand.
+ *
+ * @tparam Rhs
+ * 	Type of second operand.
+ *
+ * @tparam IsSubtraction
+ * 	If true, node is difference of operands.
+ */
+template<class Lhs, class Rhs, bool IsSubtraction>
+class IntegerSum : public IntegerExpression<IntegerSum<Lhs, Rhs, IsSubtraction>> {
+public:
+	/**
+	 * @brief
+	 * 	Creates sum node.
+	 *
+	 * @param lhs
+	 * 	First operand.
+	 *
+	 * @param rhs
+	 * 	Second operand.
+	 */
+	IntegerSum(const Lhs &lhs, const Rhs &rhs) : m_lhs{lhs}, m_rhs{rhs}{}
+
+	/**
+	 * @brief
+	 * 	Adds both operands to accumulator.
+	 *
+	 * @param accumulator
+	 * 	Accumulator of expression.
+	 *
+	 * @param isNegative
+	 * 	If true, sum is subtracted instead of added.
+	 */
+	void accumulate(IntegerAccumulator &accumulator, bool isNegative) const{
+		m_lhs.accumulate(accumulator, isNegative);
+		m_rhs.accumulate(accumulator, isNegative != IsSubtraction);
+	}
+
+	/**
+	 * @brief
+	 * 	Evaluates sum and appends it to factors of product.
+	 *
+	 * @param factors
+	 * 	Factors of product.
+	 */
+	void appendFactors(std::vector<Pointer<Integer>> &factors) const{
+		factors.push_back(this->getValue());
+	}
+
+private:
+	/**
+	 * @brief
+	 * 	First operand.
+	 */
+	Lhs m_lhs;
+
+	/**
+	 * @brief
+	 * 	Second operand.
+	 */
+	Rhs m_rhs;
+};
+
+/**
+ * @brief
+ * 	Creates product node of expressions.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor.
+ *
+ * @return
+ * 	Unevaluated product.
+ */
+template<class Lhs, class Rhs>
+IntegerProduct<Lhs, Rhs> operator*(const IntegerExpression<Lhs> &lhs, const IntegerExpression<Rhs> &rhs){
+	return IntegerProduct<Lhs, Rhs>(lhs.getDerived(), rhs.getDerived());
+}
+
+/**
+ * @brief
+ * 	Creates product node of expressions.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor, which becomes leaf of expression.
+ *
+ * @return
+ * 	Unevaluated product.
+ */
+template<class Lhs>
+IntegerProduct<Lhs, IntegerTerm> operator*(const IntegerExpression<Lhs> &lhs, Pointer<Integer> rhs){
+	return IntegerProduct<Lhs, IntegerTerm>(lhs.getDerived(), IntegerTerm(rhs));
+}
+
+/**
+ * @brief
+ * 	Creates product node of expressions.
+ *
+ * @param lhs
+ * 	First factor, which becomes leaf of expression.
+ *
+ * @param rhs
+ * 	Second factor.
+ *
+ * @return
+ * 	Unevaluated product.
+ */
+template<class Rhs>
+IntegerProduct<IntegerTerm, Rhs> operator*(Pointer<Integer> lhs, const IntegerExpression<Rhs> &rhs){
+	return IntegerProduct<IntegerTerm, Rhs>(IntegerTerm(lhs), rhs.getDerived());
+}
+
+/**
+ * @brief
+ * 	Creates sum node of expressions.
+ *
+ * @param lhs
+ * 	First operand.
+ *
+ * @param rhs
+ * 	Second operand.
+ *
+ * @return
+ * 	Unevaluated sum.
+ */
+template<class Lhs, class Rhs>
+IntegerSum<Lhs, Rhs, false> operator+(const IntegerExpression<Lhs> &lhs, const IntegerExpression<Rhs> &rhs){
+	return IntegerSum<Lhs, Rhs, false>(lhs.getDerived(), rhs.getDerived());
+}
+
+/**
+ * @brief
+ * 	Creates sum node of expressions.
+ *
+ * @param lhs
+ * 	First operand.
+ *
+ * @param rhs
+ * 	Second operand, which becomes leaf of expression.
+ *
+ * @return
+ * 	Unevaluated sum.
+ */
+template<class Lhs>
+IntegerSum<Lhs, IntegerTerm, false> operator+(const IntegerExpression<Lhs> &lhs, Pointer<Integer> rhs){
+	return IntegerSum<Lhs, IntegerTerm, false>(lhs.getDerived(), IntegerTerm(rhs));
+}
+
+/**
+ * @brief
+ * 	Creates sum node of expressions.
+ *
+ * @param lhs
+ * 	First operand, which becomes leaf of expression.
+ *
+ * @param rhs
+ * 	Second operand.
+ *
+ * @return
+ * 	Unevaluated sum.
+ */
+template<class Rhs>
+IntegerSum<IntegerTerm, Rhs, false> operator+(Pointer<Integer> lhs, const IntegerExpression<Rhs> &rhs){
+	return IntegerSum<IntegerTerm, Rhs, false>(IntegerTerm(lhs), rhs.getDerived());
+}
+
+/**
+ * @brief
+ * 	Creates difference node of expressions.
+ *
+ * @param lhs
+ * 	Minuend.
+ *
+ * @param rhs
+ * 	Subtrahend.
+ *
+ * @return
+ * 	Unevaluated difference.
+ */
+template<class Lhs, class Rhs>
+IntegerSum<Lhs, Rhs, true> operator-(const IntegerExpression<Lhs> &lhs, const IntegerExpression<Rhs> &rhs){
+	return IntegerSum<Lhs, Rhs, true>(lhs.getDerived(), rhs.getDerived());
+}
+
+/**
+ * @brief
+ * 	Creates difference node of expressions.
+ *
+ * @param lhs
+ * 	Minuend.
+ *
+ * @param rhs
+ * 	Subtrahend, which becomes leaf of expression.
+ *
+ * @return
+ * 	Unevaluated difference.
+ */
+template<class Lhs>
+IntegerSum<Lhs, IntegerTerm, true> operator-(const IntegerExpression<Lhs> &lhs, Pointer<Integer> rhs){
+	return IntegerSum<Lhs, IntegerTerm, true>(lhs.getDerived(), IntegerTerm(rhs));
+}
+
+/**
+ * @brief
+ * 	Creates difference node of expressions.
+ *
+ * @param lhs
+ * 	Minuend, which becomes leaf of expression.
+ *
+ * @param rhs
+ * 	Subtrahend.
+ *
+ * @return
+ * 	Unevaluated difference.
+ */
+template<class Rhs>
+IntegerSum<IntegerTerm, Rhs, true> operator-(Pointer<Integer> lhs, const IntegerExpression<Rhs> &rhs){
+	return IntegerSum<IntegerTerm, Rhs, true>(IntegerTerm(lhs), rhs.getDerived());
+}
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_INTEGEREXPRESSION_H_ */
@@ -0,0 +1,238 @@
+/*
+ * ModularBasis.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "ModularBasis.h"
+#include "Unsigned.h"
+
+#include <utility>
+
+namespace coma {
+namespace numb {
+
+namespace{
+
+/**
+ * @brief
+ * 	Minimal length in bits of node of subproduct tree, which is used to reduce numbers in remainder tree.
+ */
+const unsigned long long TREE_THRESHOLD { 1ull << 18 };
+
+/**
+ * @brief
+ * 	Multiplies two Integers.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor.
+ *
+ * @return
+ * 	@a lhs * @a rhs.
+ */
+Pointer<Integer> multiply(Pointer<Integer> lhs, Pointer<Integer> rhs){
+	return staticPointerCast<Integer>(lhs->getProduct(rhs));
+}
+
+/**
+ * @brief
+ * 	Reduces non-negative Integer by positive modulus.
+ *
+ * @details
+ * 	Reduction is skipped if @a number is already lesser than modulus.
+ *
+ * @param number
+ * 	Non-negative number.
+ *
+ * @param reducer
+ * 	Reducer of positive modulus.
+ *
+ * @return
+ * 	@a number mod modulus.
+ */
+Pointer<Integer> reduce(Pointer<Integer> number, const BarrettReducer &reducer){
+	if(number->compare(reducer.getModulus()) == CompareResult::ThisLesser) return number;
+	return reducer.getRemainder(number);
+}
+
+/**
+ * @brief
+ * 	Finds modular inverse of word with extended Euclidean algorithm.
+ *
+ * @details
+ * 	Only magnitudes of Bezout coefficients are stored, as their signs alternate, so no intermediate value
+ * 	exceeds @a modulus.
+ *
+ * @param value
+ * 	Number lesser than @a modulus.
+ *
+ * @param modulus
+ * 	Positive modulus.
+ *
+ * @param inverse
+ * 	Variable for inverse.
+ *
+ * @return
+ * 	True if @a value and @a modulus are coprime, so the inverse exists. Else returns false.
+ */
+bool getInverse(unsigned long long value, unsigned long long modulus, unsigned long long &inverse){
+	if(modulus == 1){
+		inverse = 0;
+		return true;
+	}
+	unsigned long long a { value }, b { modulus }, x { 1 }, y { 0 };
+	bool isNegative { false };
+	while(b){
+		unsigned long long quotient { a / b };
+		a -= quotient * b;
+		std::swap(a, b);
+		x += quotient * y;
+		std::swap(x, y);
+		isNegative = !isNegative;
+	}
+	if(a != 1) return false;
+	inverse = isNegative ? modulus - x : x;
+	return true;
+}
+
+}
+
+ModularBasis::ModularBasis(const std::vector<unsigned long long> &moduli) :
+		m_moduli{moduli},
+		m_tree{},
+		m_reducers{},
+		m_inverses{}{
+	if(m_moduli.empty()){
+		REPORT_CONSTRUCTOR_ERROR(std::exception("Empty range exception"), clear());
+	}
+	std::vector<Pointer<Integer>> level;
+	for(unsigned long long modulus : m_moduli){
+		if(!modulus){
+			REPORT_CONSTRUCTOR_ERROR(std::exception("Division by zero exception"), clear());
+		}
+		level.push_back(Unsigned::fromUnsignedLongLong(modulus));
+	}
+	m_tree.push_back(level);
+	m_reducers.emplace_back();
+	while(level.size() > 1){
+		std::vector<Pointer<Integer>> parents;
+		for(std::size_t i = 0; i < level.size(); i += 2){
+			parents.push_back(i + 1 < level.size() ? multiply(level[i], level[i + 1]) : level[i]);
+		}
+		//small nodes other than root are not used in remainder tree, so they need no reducers
+		std::vector<Pointer<BarrettReducer>> reducers;
+		if(parents.size() == 1 || parents.front()->getBitLength() >= TREE_THRESHOLD){
+			for(std::size_t i = 0; i < parents.size(); ++i){
+				bool isMoved { 2 * i + 1 == level.size() && !m_reducers.back().empty() };
+				reducers.push_back(isMoved ? m_reducers.back()[2 * i] : std::make_shared<const BarrettReducer>(parents[i]));
+			}
+		}
+		m_tree.push_back(parents);
+		m_reducers.push_back(reducers);
+		level.swap(parents);
+	}
+	std::vector<unsigned long long> cofactors = descend(Number::ONE(), true);
+	m_inverses.resize(m_moduli.size());
+	for(std::size_t i = 0; i < m_moduli.size(); ++i){
+		if(!getInverse(cofactors[i], m_moduli[i], m_inverses[i])){
+			REPORT_CONSTRUCTOR_ERROR(std::exception("Not coprime moduli exception"), clear());
+		}
+	}
+}
+
+std::vector<unsigned long long> ModularBasis::getRemainders(Pointer<Integer> number) const{
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), std::vector<unsigned long long>());
+	Pointer<Integer> magnitude = staticPointerCast<Integer>(number->getAbsoluteValue());
+	std::vector<unsigned long long> remainders = descend(magnitude, false);
+	if(number->isNegative()){
+		for(std::size_t i = 0; i < remainders.size(); ++i){
+			if(remainders[i]) remainders[i] = m_moduli[i] - remainders[i];
+		}
+	}
+	return remainders;
+}
+
+Pointer<Integer> ModularBasis::getReconstruction(const std::vector<unsigned long long> &remainders,
+		bool isSymmetric) const{
+	if(remainders.size() != m_moduli.size()){
+		REPORT_ERROR(std::exception("Wrong number of remainders exception"), nullptr);
+	}
+	std::vector<Pointer<Integer>> values;
+	for(std::size_t i = 0; i < m_moduli.size(); ++i){
+		Pointer<Integer> term = multiply(Unsigned::fromUnsignedLongLong(remainders[i] % m_moduli[i]),
+				Unsigned::fromUnsignedLongLong(m_inverses[i]));
+		values.push_back(Unsigned::fromUnsignedLongLong(term->getSmallRemainder(m_moduli[i])));
+	}
+	//node value is sum of children values multiplied by products of their siblings
+	for(std::size_t level = 1; level < m_tree.size(); ++level){
+		const std::vector<Pointer<Integer>> &children = m_tree[level - 1];
+		std::vector<Pointer<Integer>> parents;
+		for(std::size_t i = 0; i < children.size(); i += 2){
+			if(i + 1 < children.size()){
+				parents.push_back(staticPointerCast<Integer>(multiply(values[i], children[i + 1])->getSum(
+						multiply(values[i + 1], children[i]))));
+			}else{
+				parents.push_back(values[i]);
+			}
+		}
+		values.swap(parents);
+	}
+	Pointer<Integer> result = m_reducers.back().empty() ? values.front() : reduce(values.front(), *m_reducers.back().front());
+	if(isSymmetric && result->getShiftedLeft(1)->compare(getModulus()) == CompareResult::ThisGreater){
+		result = staticPointerCast<Integer>(result->getDifference(getModulus()));
+	}
+	return result;
+}
+
+Pointer<Integer> ModularBasis::getModulus() const noexcept{
+	return m_tree.back().front();
+}
+
+const std::vector<unsigned long long> &ModularBasis::getModuli() const noexcept{
+	return m_moduli;
+}
+
+void ModularBasis::clear(){
+	m_moduli.assign(1, 1);
+	m_tree.assign(1, std::vector<Pointer<Integer>>(1, Number::ONE()));
+	m_reducers.assign(1, std::vector<Pointer<BarrettReducer>>());
+	m_inverses.assign(1, 0);
+}
+
+std::vector<unsigned long long> ModularBasis::descend(Pointer<Integer> number, bool withSiblings) const{
+	std::size_t lowest { m_tree.size() - 1 };
+	while(lowest > 0 && !m_reducers[lowest - 1].empty()) --lowest;
+	std::vector<Pointer<Integer>> values(1, number);
+	if(!m_reducers.back().empty()) values.front() = reduce(number, *m_reducers.back().front());
+	for(std::size_t level = m_tree.size() - 1; level > lowest; --level){
+		const std::vector<Pointer<Integer>> &children = m_tree[level - 1];
+		std::vector<Pointer<Integer>> next;
+		for(std::size_t i = 0; i < children.size(); ++i){
+			Pointer<Integer> value = values[i / 2];
+			if(withSiblings && (i ^ 1) < children.size()) value = multiply(value, children[i ^ 1]);
+			next.push_back(reduce(value, *m_reducers[level - 1][i]));
+		}
+		values.swap(next);
+	}
+	//word division by every modulus is faster than Barrett reduction by small nodes
+	std::vector<unsigned long long> remainders;
+	for(std::size_t i = 0; i < m_moduli.size(); ++i){
+		unsigned long long remainder { values[i >> lowest]->getSmallRemainder(m_moduli[i]) };
+		if(withSiblings){
+			//product of other moduli below the node
+			Pointer<Integer> others = m_tree[lowest][i >> lowest]->getSmallQuotient(m_moduli[i]);
+			Pointer<Integer> product = multiply(Unsigned::fromUnsignedLongLong(remainder),
+					Unsigned::fromUnsignedLongLong(others->getSmallRemainder(m_moduli[i])));
+			remainder = product->getSmallRemainder(m_moduli[i]);
+		}
+		remainders.push_back(remainder);
+	}
+	return remainders;
+}
+
+} /* namespace numb */
+} /* namespace coma */
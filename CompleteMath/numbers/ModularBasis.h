@@ -0,0 +1,144 @@
+/*
+ * ModularBasis.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_MODULARBASIS_H_
+#define NUMBERS_MODULARBASIS_H_
+
+#include "Integer.h"
+#include "BarrettReducer.h"
+
+#include <vector>
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Set of pairwise coprime word sized moduli for multi-modular computations.
+ *
+ * @details
+ * 	Subproduct tree of the moduli is built once in constructor: leaves are the moduli and every node is product
+ * 	of its children. Remainders of one Integer by all moduli are found by descending the tree (remainder tree),
+ * 	so the big number is reduced only by products of similar size, using Barrett reducers precomputed for every
+ * 	inner node. Chinese remainder reconstruction ascends the same tree, combining partial results of children
+ * 	with products of their siblings.
+ */
+class ModularBasis {
+public:
+	/**
+	 * @brief
+	 * 	Builds subproduct tree and Chinese remainder coefficients of given moduli.
+	 *
+	 * @param moduli
+	 * 	Non-empty sequence of pairwise coprime positive moduli.
+	 */
+	explicit ModularBasis(const std::vector<unsigned long long> &moduli);
+
+	/**
+	 * @brief
+	 * 	Finds remainders of given Integer by all moduli.
+	 *
+	 * @param number
+	 * 	Integer to reduce.
+	 *
+	 * @return
+	 * 	Values @a number mod m_i in range [0, m_i), in order of moduli.
+	 */
+	std::vector<unsigned long long> getRemainders(Pointer<Integer> number) const;
+
+	/**
+	 * @brief
+	 * 	Reconstructs Integer from its remainders with Chinese remainder theorem.
+	 *
+	 * @param remainders
+	 * 	Remainders by all moduli, in order of moduli.
+	 *
+	 * @param isSymmetric
+	 * 	If true, result is taken from range (-M/2, M/2], so that negative numbers can be reconstructed.
+	 *
+	 * @return
+	 * 	Unique x in [0, M) (or in symmetric range) such that x mod m_i equals @a remainders[i], where M is product
+	 * 	of moduli.
+	 */
+	Pointer<Integer> getReconstruction(const std::vector<unsigned long long> &remainders,
+			bool isSymmetric = false) const;
+
+	/**
+	 * @brief
+	 * 	Product of moduli getter.
+	 *
+	 * @return
+	 * 	Product of all moduli.
+	 */
+	Pointer<Integer> getModulus() const noexcept;
+
+	/**
+	 * @brief
+	 * 	Moduli getter.
+	 *
+	 * @return
+	 * 	Moduli as passed to constructor.
+	 */
+	const std::vector<unsigned long long> &getModuli() const noexcept;
+
+private:
+	/**
+	 * @brief
+	 * 	Replaces moduli with single modulus equal to one.
+	 */
+	void clear();
+
+	/**
+	 * @brief
+	 * 	Reduces number by all moduli descending subproduct tree.
+	 *
+	 * @details
+	 * 	Tree is descended only through nodes which have reducers. Below them every modulus divides value of its
+	 * 	lowest reduced ancestor directly.
+	 *
+	 * @param number
+	 * 	Non-negative number.
+	 *
+	 * @param withSiblings
+	 * 	If true, value of every node is multiplied by product of its sibling before reducing by the child, so
+	 * 	for @a number equal to one, leaves receive M / m_i mod m_i.
+	 *
+	 * @return
+	 * 	Remainders by moduli.
+	 */
+	std::vector<unsigned long long> descend(Pointer<Integer> number, bool withSiblings) const;
+
+	/**
+	 * @brief
+	 * 	Moduli as passed to constructor.
+	 */
+	std::vector<unsigned long long> m_moduli;
+
+	/**
+	 * @brief
+	 * 	Subproduct tree, level zero contains moduli and the last level contains their product.
+	 */
+	std::vector<std::vector<Pointer<Integer>>> m_tree;
+
+	/**
+	 * @brief
+	 * 	Reducers of nodes of subproduct tree. Levels of nodes shorter than fixed threshold, except the root,
+	 * 	are empty, as word division by every modulus is faster there.
+	 */
+	std::vector<std::vector<Pointer<BarrettReducer>>> m_reducers;
+
+	/**
+	 * @brief
+	 * 	Inverses of M / m_i modulo m_i.
+	 */
+	std::vector<unsigned long long> m_inverses;
+};
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_MODULARBASIS_H_ */
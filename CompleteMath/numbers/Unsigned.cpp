@@ -1,290 +1,345 @@
-/*
- * Unsigned.cpp
- *
- *  Created on: 24 cze 2015
- *      Author: Bartosz Miera
- */
-
-#include <algorithm>
-#include <memory>
-#include <string>
-#include <sstream>
-#include <iomanip>
-
-#include "Unsigned.h"
-#include "Signed.h"
-#include "FloatingPoint.h"
-#include "Complex.h"
-
-#include "../Utility/Numbers.h"
-#include "../Utility/BaseConverter.h"
-#include "../Utility/ArrayArithmetic.h"
-
-namespace coma {
-namespace numb {
-
-//======================================
-//--------------UNSIGNED----------------
-//======================================
-
-Unsigned::Unsigned(const tech::RuntimeArray<unsigned char> &array, const Endianess endianess) :
-		Integer(util::withoutMeaninglessChars(array, false), endianess){}
-
-Pointer<Unsigned> Unsigned::fromBigEndianArray(const tech::RuntimeArray<unsigned char> &array){
-	return std::make_shared<const Unsigned>(array, Endianess::Big);
-}
-
-Pointer<Unsigned> Unsigned::fromLittleEndianArray(const tech::RuntimeArray<unsigned char> &array){
-	return std::make_shared<const Unsigned>(array, Endianess::Little);
-}
-
-Pointer<Unsigned> Unsigned::fromBinaryInString(const std::string &binaryInString){
-	return fromHexadecimalInString(util::BaseConverter("01","0123456789ABCDEF").convert(binaryInString));
-}
-
-Pointer<Unsigned> Unsigned::fromOctalInString(const std::string &octalInString){
-	return fromHexadecimalInString(util::BaseConverter("01234567","0123456789ABCDEF").convert(octalInString));
-}
-
-Pointer<Unsigned> Unsigned::fromDecimalInString(const std::string &decimalInString){
-	return fromHexadecimalInString(util::BaseConverter::decimalToHexConverter().convert(decimalInString));
-}
-
-Pointer<Unsigned> Unsigned::fromHexadecimalInString(const std::string &hexadecimalInString){
-	std::unique_ptr<unsigned char[]> chars{util::numb::arrayFromHexadecimal(hexadecimalInString)};
-	unsigned long long length = util::numb::sizeFromHexadecimal(hexadecimalInString);
-	return fromLittleEndianArray({chars.get(), length});
-}
-
-//======================================
-//--------------COPYABLE----------------
-//======================================
-
-Pointer<Number> Unsigned::copy() const{
-	return sharedThis();
-}
-
-//======================================
-//-------------ARITHMETIC---------------
-//======================================
-
-Pointer<Number> Unsigned::getSum(Pointer<Number> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toAdd->getSum(sharedThis());
-}
-
-Pointer<Number> Unsigned::getSum(Pointer<Complex> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toAdd->getSum(sharedThis());
-}
-
-Pointer<Number> Unsigned::getSum(Pointer<FloatingPoint> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toAdd->getSum(sharedThis());
-}
-
-Pointer<Number> Unsigned::getSum(Pointer<Signed> toAdd) const{
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toAdd->getSum(sharedThis());
-}
-
-Pointer<Number> Unsigned::getSum(Pointer<Unsigned> toAdd) const{
-	using namespace util;
-	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	tech::RuntimeArray<unsigned char> tmp(std::max(this->getArray().length(), toAdd->getArray().length()) + 1);
-	std::copy(getArray().begin(), getArray().end(), tmp.begin());
-	tmp += toAdd->getArray();
-	return fromLittleEndianArray(tmp);
-}
-
-Pointer<Number> Unsigned::getProduct(Pointer<Number> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toMultiply->getProduct(sharedThis());
-}
-
-Pointer<Number> Unsigned::getProduct(Pointer<Complex> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toMultiply->getProduct(sharedThis());
-}
-
-Pointer<Number> Unsigned::getProduct(Pointer<FloatingPoint> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toMultiply->getProduct(sharedThis());
-}
-
-Pointer<Number> Unsigned::getProduct(Pointer<Signed> toMultiply) const{
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	return toMultiply->getProduct(sharedThis());
-}
-
-Pointer<Number> Unsigned::getProduct(Pointer<Unsigned> toMultiply) const{
-	using namespace util;
-	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	tech::RuntimeArray<unsigned char> tmp(this->getArray().length() + toMultiply->getArray().length());
-	std::copy(getArray().begin(), getArray().end(), tmp.begin());
-	tmp *= toMultiply->getArray();
-	return fromLittleEndianArray(tmp);
-}
-
-//======================================
-//---------------NUMBER-----------------
-//======================================
-
-bool Unsigned::isZero() const noexcept{
-	return getArray().length() == 1 && getArray()[0] == 0;
-}
-
-std::string Unsigned::getAsBinary() const {
-	std::string num = getAsHexadecimal();
-	return coma::util::BaseConverter("01234567890ABCDEF", "01").convert(num);
-}
-
-std::string Unsigned::getAsOctal() const {
-	std::string num = getAsHexadecimal();
-	return coma::util::BaseConverter("01234567890ABCDEF", "01234567").convert(num);
-}
-
-std::string Unsigned::getAsDecimal() const {
-	std::string num = getAsHexadecimal();
-	return coma::util::BaseConverter::hexToDecimalConverter().convert(num);
-}
-
-std::string Unsigned::getAsHexadecimal() const {
-	std::stringstream ss{ };
-	ss << std::uppercase;
-	ss << std::setfill('0');
-	for(unsigned long long i = 0; i < getArray().length(); ++i){
-		unsigned int tmp = getArray()[getArray().length() - 1 - i];
-		ss << std::hex << std::setw(2) << tmp;
-	}
-	std::string tmp = ss.str();
-	coma::util::numb::removeLeftTrailingZeroes(tmp);
-	return tmp;
-}
-
-Pointer<Unsigned> Unsigned::getAsUnsignedInteger() const{
-	return sharedThis();
-}
-
-Pointer<Signed> Unsigned::getAsSignedInteger() const{
-	tech::RuntimeArray<unsigned char> tmp(getArray().length() + 1);
-	std::copy(getArray().begin(), getArray().end(), tmp.begin());
-	return Signed::fromLittleEndianArray(tmp);
-}
-
-Pointer<FloatingPoint> Unsigned::getAsFloatingPoint() const{
-	return FloatingPoint::fromFraction(sharedThis(),
-			ONE(),
-			ZERO());
-}
-
-Pointer<Complex> Unsigned::getAsComplex() const{
-	//TODO complete after Complex definition
-}
-
-Pointer<Number> Unsigned::getNegation() const{
-	return getAsSignedInteger()->getNegation();
-}
-
-Pointer<Number> Unsigned::getInversion() const{
-	return FloatingPoint::fromFraction(ONE(),
-			sharedThis(),
-			ZERO());
-}
-
-bool Unsigned::isNegative() const noexcept{
-	return false;
-}
-
-bool Unsigned::isPositive() const noexcept{
-	return !isZero();
-}
-
-//======================================
-//---------INTEGERARITHMETIC------------
-//======================================
-
-Pointer<Integer> Unsigned::getIntegerQuotient(Pointer<Integer> toDivide) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					toDivide)->getIntegerQuotientInverse(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getRemainder(Pointer<Integer> toDivide) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					toDivide)->getInverseRemainder(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getIntegerQuotientInverse(Pointer<Integer> dividend) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					dividend)->getIntegerQuotient(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getInverseRemainder(Pointer<Integer> dividend) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					dividend)->getInverseRemainder(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getIntegerQuotient(Pointer<Signed> toDivide) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					toDivide)->getIntegerQuotientInverse(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getRemainder(Pointer<Signed> toDivide) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					toDivide)->getInverseRemainder(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getIntegerQuotientInverse(Pointer<Signed> dividend) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					dividend)->getIntegerQuotient(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getInverseRemainder(Pointer<Signed> dividend) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					dividend)->getRemainder(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getIntegerQuotient(Pointer<Unsigned> toDivide) const{
-	using namespace util;
-	if(!toDivide) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	if(toDivide->isZero()) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
-	tech::RuntimeArray<unsigned char> result = getArray();
-	result /= toDivide->getArray();
-	return fromLittleEndianArray(result);
-}
-
-Pointer<Integer> Unsigned::getRemainder(Pointer<Unsigned> toDivide) const{
-	using namespace util;
-	if(!toDivide) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
-	if(toDivide->isZero()) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
-	tech::RuntimeArray<unsigned char> result = getArray();
-	result %= toDivide->getArray();
-	return fromLittleEndianArray(result);
-}
-
-Pointer<Integer> Unsigned::getIntegerQuotientInverse(Pointer<Unsigned> dividend) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					dividend)->getIntegerQuotient(sharedThis());
-}
-
-Pointer<Integer> Unsigned::getInverseRemainder(Pointer<Unsigned> dividend) const{
-	return staticPointerCast<
-			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
-					dividend)->getRemainder(sharedThis());
-}
-
-Pointer<Unsigned> Unsigned::sharedThis() const{
-	return staticPointerCast<Unsigned>(shared_from_this());
-}
-
-} /* namespace numb */
-} /* namespace coma */
+/*
+ * Unsigned.cpp
+ *
+ *  Created on: 24 cze 2015
+ *      Author: Bartosz Miera
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+
+#include "Unsigned.h"
+#include "Signed.h"
+#include "FloatingPoint.h"
+#include "Complex.h"
+
+#include "../Utility/Numbers.h"
+#include "../Utility/BaseConverter.h"
+#include "../Utility/ArrayArithmetic.h"
+
+namespace coma {
+namespace numb {
+
+//======================================
+//--------------UNSIGNED----------------
+//======================================
+
+Unsigned::Unsigned(const tech::RuntimeArray<unsigned char> &array, const Endianess endianess) :
+		Integer(util::withoutMeaninglessChars(array, false), endianess){}
+
+Unsigned::Unsigned(const Integer &number) :
+		Integer(number){}
+
+Pointer<Unsigned> Unsigned::fromBigEndianArray(const tech::RuntimeArray<unsigned char> &array){
+	return std::make_shared<const Unsigned>(array, Endianess::Big);
+}
+
+Pointer<Unsigned> Unsigned::fromLittleEndianArray(const tech::RuntimeArray<unsigned char> &array){
+	return std::make_shared<const Unsigned>(array, Endianess::Little);
+}
+
+Pointer<Unsigned> Unsigned::fromBinaryInString(const std::string &binaryInString){
+	return fromHexadecimalInString(util::BaseConverter("01","0123456789ABCDEF").convert(binaryInString));
+}
+
+Pointer<Unsigned> Unsigned::fromOctalInString(const std::string &octalInString){
+	return fromHexadecimalInString(util::BaseConverter("01234567","0123456789ABCDEF").convert(octalInString));
+}
+
+Pointer<Unsigned> Unsigned::fromDecimalInString(const std::string &decimalInString){
+	return fromHexadecimalInString(util::BaseConverter::decimalToHexConverter().convert(decimalInString));
+}
+
+Pointer<Unsigned> Unsigned::fromHexadecimalInString(const std::string &hexadecimalInString){
+	std::unique_ptr<unsigned char[]> chars{util::numb::arrayFromHexadecimal(hexadecimalInString)};
+	unsigned long long length = util::numb::sizeFromHexadecimal(hexadecimalInString);
+	return fromLittleEndianArray({chars.get(), length});
+}
+
+Pointer<Unsigned> Unsigned::fromUnsignedLongLong(unsigned long long value){
+	tech::RuntimeArray<unsigned char> array(sizeof(value));
+	for(unsigned long long i = 0; i < array.length(); ++i, value >>= 8) array[i] = static_cast<unsigned char>(value);
+	return fromLittleEndianArray(array);
+}
+
+//======================================
+//--------------COPYABLE----------------
+//======================================
+
+Pointer<Number> Unsigned::copy() const{
+	return sharedThis();
+}
+
+//======================================
+//-------------ARITHMETIC---------------
+//======================================
+
+Pointer<Number> Unsigned::getSum(Pointer<Number> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toAdd->getSum(sharedThis());
+}
+
+Pointer<Number> Unsigned::getSum(Pointer<Complex> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toAdd->getSum(sharedThis());
+}
+
+Pointer<Number> Unsigned::getSum(Pointer<FloatingPoint> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toAdd->getSum(sharedThis());
+}
+
+Pointer<Number> Unsigned::getSum(Pointer<Signed> toAdd) const{
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return getSignedSum(*this, *toAdd, false);
+}
+
+Pointer<Number> Unsigned::getSum(Pointer<Unsigned> toAdd) const{
+	using namespace util;
+	if(!toAdd) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	tech::RuntimeArray<unsigned char> tmp(std::max(this->getArray().length(), toAdd->getArray().length()) + 1);
+	std::copy(getArray().begin(), getArray().end(), tmp.begin());
+	tmp += toAdd->getArray();
+	return fromLittleEndianArray(tmp);
+}
+
+Pointer<Number> Unsigned::getProduct(Pointer<Number> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toMultiply->getProduct(sharedThis());
+}
+
+Pointer<Number> Unsigned::getProduct(Pointer<Complex> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toMultiply->getProduct(sharedThis());
+}
+
+Pointer<Number> Unsigned::getProduct(Pointer<FloatingPoint> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toMultiply->getProduct(sharedThis());
+}
+
+Pointer<Number> Unsigned::getProduct(Pointer<Signed> toMultiply) const{
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return getSignedProduct(*this, *toMultiply);
+}
+
+Pointer<Number> Unsigned::getProduct(Pointer<Unsigned> toMultiply) const{
+	using namespace util;
+	if(!toMultiply) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	tech::RuntimeArray<unsigned char> tmp(this->getArray().length() + toMultiply->getArray().length());
+	std::copy(getArray().begin(), getArray().end(), tmp.begin());
+	if(toMultiply.get() == this) square(tmp);
+	else tmp *= toMultiply->getArray();
+	return fromLittleEndianArray(tmp);
+}
+
+Pointer<Number> Unsigned::getDifference(Pointer<Number> toSubtract) const{
+	if(!toSubtract) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return toSubtract->getInverseDifference(sharedThis());
+}
+
+Pointer<Number> Unsigned::getInverseDifference(Pointer<Signed> minuend) const{
+	if(!minuend) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return getDifferenceOf(*minuend, *this);
+}
+
+Pointer<Number> Unsigned::getInverseDifference(Pointer<Unsigned> minuend) const{
+	if(!minuend) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return getDifferenceOf(*minuend, *this);
+}
+
+//======================================
+//---------------NUMBER-----------------
+//======================================
+
+bool Unsigned::isZero() const noexcept{
+	return getArray().length() == 1 && getArray()[0] == 0;
+}
+
+NumberType Unsigned::getType() const noexcept{
+	return NumberType::Unsigned;
+}
+
+std::string Unsigned::getAsBinary() const {
+	std::string num = getAsHexadecimal();
+	return coma::util::BaseConverter("01234567890ABCDEF", "01").convert(num);
+}
+
+std::string Unsigned::getAsOctal() const {
+	std::string num = getAsHexadecimal();
+	return coma::util::BaseConverter("01234567890ABCDEF", "01234567").convert(num);
+}
+
+std::string Unsigned::getAsDecimal() const {
+	//19 digits at once, the most that fits in one word
+	tech::RuntimeArray<unsigned char> value = getArray();
+	std::vector<unsigned long long> chunks{ };
+	do{
+		chunks.push_back(util::divmodSmall(value, 10000000000000000000ull));
+		value = util::withoutMeaninglessChars(value, false);
+	}while(value.length() > 1 || value[0]);
+	std::stringstream ss{ };
+	ss << chunks.back() << std::setfill('0');
+	for(unsigned long long i = chunks.size() - 1; i-- > 0;) ss << std::setw(19) << chunks[i];
+	return ss.str();
+}
+
+std::string Unsigned::getAsHexadecimal() const {
+	std::stringstream ss{ };
+	ss << std::uppercase;
+	ss << std::setfill('0');
+	for(unsigned long long i = 0; i < getArray().length(); ++i){
+		unsigned int tmp = getArray()[getArray().length() - 1 - i];
+		ss << std::hex << std::setw(2) << tmp;
+	}
+	std::string tmp = ss.str();
+	coma::util::numb::removeLeftTrailingZeroes(tmp);
+	return tmp;
+}
+
+Pointer<Unsigned> Unsigned::getAsUnsignedInteger() const{
+	return sharedThis();
+}
+
+Pointer<Signed> Unsigned::getAsSignedInteger() const{
+	return std::make_shared<const Signed>(*this, false);
+}
+
+Pointer<FloatingPoint> Unsigned::getAsFloatingPoint() const{
+	return FloatingPoint::fromFraction(sharedThis(),
+			ONE(),
+			ZERO());
+}
+
+Pointer<Complex> Unsigned::getAsComplex() const{
+	//TODO complete after Complex definition
+}
+
+Pointer<Number> Unsigned::getNegation() const{
+	return std::make_shared<const Signed>(*this, true);
+}
+
+Pointer<Number> Unsigned::getInversion() const{
+	return FloatingPoint::fromFraction(ONE(),
+			sharedThis(),
+			ZERO());
+}
+
+bool Unsigned::isNegative() const noexcept{
+	return false;
+}
+
+bool Unsigned::isPositive() const noexcept{
+	return !isZero();
+}
+
+//======================================
+//---------------INTEGER----------------
+//======================================
+
+Pointer<Integer> Unsigned::getShiftedLeft(unsigned long long bits) const{
+	tech::RuntimeArray<unsigned char> tmp(getArray().length() + bits / 8 + 1);
+	std::copy(getArray().begin(), getArray().end(), tmp.begin());
+	util::shiftBitsLeft(tmp, bits);
+	return fromLittleEndianArray(tmp);
+}
+
+Pointer<Integer> Unsigned::getShiftedRight(unsigned long long bits) const{
+	if(bits / 8 >= getArray().length()) return ZERO();
+	tech::RuntimeArray<unsigned char> tmp = getArray();
+	util::shiftBitsRight(tmp, bits);
+	return fromLittleEndianArray(tmp);
+}
+
+//======================================
+//---------INTEGERARITHMETIC------------
+//======================================
+
+Pointer<Integer> Unsigned::getIntegerQuotient(Pointer<Integer> toDivide) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					toDivide)->getIntegerQuotientInverse(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getRemainder(Pointer<Integer> toDivide) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					toDivide)->getInverseRemainder(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getIntegerQuotientInverse(Pointer<Integer> dividend) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					dividend)->getIntegerQuotient(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getInverseRemainder(Pointer<Integer> dividend) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					dividend)->getInverseRemainder(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getIntegerQuotient(Pointer<Signed> toDivide) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					toDivide)->getIntegerQuotientInverse(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getRemainder(Pointer<Signed> toDivide) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					toDivide)->getInverseRemainder(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getIntegerQuotientInverse(Pointer<Signed> dividend) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					dividend)->getIntegerQuotient(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getInverseRemainder(Pointer<Signed> dividend) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					dividend)->getRemainder(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getIntegerQuotient(Pointer<Unsigned> toDivide) const{
+	using namespace util;
+	if(!toDivide) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(toDivide->isZero()) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
+	tech::RuntimeArray<unsigned char> result = getArray();
+	result /= toDivide->getArray();
+	return fromLittleEndianArray(result);
+}
+
+Pointer<Integer> Unsigned::getRemainder(Pointer<Unsigned> toDivide) const{
+	using namespace util;
+	if(!toDivide) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(toDivide->isZero()) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
+	tech::RuntimeArray<unsigned char> result = getArray();
+	result %= toDivide->getArray();
+	return fromLittleEndianArray(result);
+}
+
+Pointer<Integer> Unsigned::getIntegerQuotientInverse(Pointer<Unsigned> dividend) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					dividend)->getIntegerQuotient(sharedThis());
+}
+
+Pointer<Integer> Unsigned::getInverseRemainder(Pointer<Unsigned> dividend) const{
+	return staticPointerCast<
+			coma::numb::IntegerArithmetic<Pointer<Unsigned> , Pointer<Integer> >>(
+					dividend)->getRemainder(sharedThis());
+}
+
+Pointer<Unsigned> Unsigned::sharedThis() const{
+	return staticPointerCast<Unsigned>(shared_from_this());
+}
+
+} /* namespace numb */
+} /* namespace coma */
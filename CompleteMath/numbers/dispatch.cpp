@@ -0,0 +1,41 @@
+/*
+ * dispatch.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "dispatch.h"
+
+namespace coma {
+namespace numb {
+
+Pointer<Number> getSum(Pointer<Number> lhs, Pointer<Number> rhs){
+	if(!lhs || !rhs) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return dispatch(lhs, [&rhs](const auto &left){
+		return dispatch(rhs, [&left](const auto &right){
+			return getSum(left, right);
+		});
+	});
+}
+
+Pointer<Number> getDifference(Pointer<Number> lhs, Pointer<Number> rhs){
+	if(!lhs || !rhs) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return dispatch(lhs, [&rhs](const auto &left){
+		return dispatch(rhs, [&left](const auto &right){
+			return getDifference(left, right);
+		});
+	});
+}
+
+Pointer<Number> getProduct(Pointer<Number> lhs, Pointer<Number> rhs){
+	if(!lhs || !rhs) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return dispatch(lhs, [&rhs](const auto &left){
+		return dispatch(rhs, [&left](const auto &right){
+			return getProduct(left, right);
+		});
+	});
+}
+
+} /* namespace numb */
+} /* namespace coma */
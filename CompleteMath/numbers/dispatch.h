@@ -0,0 +1,353 @@
+/*
+ * dispatch.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_DISPATCH_H_
+#define NUMBERS_DISPATCH_H_
+
+#include "Unsigned.h"
+#include "Signed.h"
+#include "FloatingPoint.h"
+#include "Complex.h"
+
+#include <type_traits>
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Tag of concrete class of number known at compile time.
+ *
+ * @details
+ * 	Defined only for Unsigned, Signed, FloatingPoint and Complex, so typed functions of this header take part in
+ * 	overload resolution only for them.
+ *
+ * @tparam T
+ * 	Class of number.
+ */
+template<class T>
+class NumberTraits {};
+
+template<>
+class NumberTraits<Unsigned> : public std::integral_constant<NumberType, NumberType::Unsigned> {};
+
+template<>
+class NumberTraits<Signed> : public std::integral_constant<NumberType, NumberType::Signed> {};
+
+template<>
+class NumberTraits<FloatingPoint> : public std::integral_constant<NumberType, NumberType::FloatingPoint> {};
+
+template<>
+class NumberTraits<Complex> : public std::integral_constant<NumberType, NumberType::Complex> {};
+
+/**
+ * @brief
+ * 	Calls function with number cast to its concrete class.
+ *
+ * @details
+ * 	Class is found by switch over tag of number, so only one virtual call is made.
+ *
+ * @param number
+ * 	Not null number.
+ *
+ * @param function
+ * 	Function callable with Pointer to each of Unsigned, Signed, FloatingPoint and Complex, returning the same
+ * 	type for all of them.
+ *
+ * @return
+ * 	Value returned by @a function.
+ */
+template<class Function>
+auto dispatch(const Pointer<Number> &number, Function function) -> decltype(function(Pointer<Unsigned>()));
+
+/**
+ * @brief
+ * 	Arithmetic on numbers of concrete classes known at compile time.
+ *
+ * @details
+ * 	Operation is done by typed method of operand of greater NumberType, which converts the other operand
+ * 	itself, so no call goes through Pointer<Number> and no shared pointer to @c this is created. For equal
+ * 	classes right operand does it, like at the end of double dispatch started by left one.
+ *
+ * @tparam Lhs
+ * 	Class of left operand.
+ *
+ * @tparam Rhs
+ * 	Class of right operand.
+ */
+template<class Lhs, class Rhs>
+class TypedArithmetic {
+public:
+	/**
+	 * @brief
+	 * 	Adds numbers.
+	 *
+	 * @param lhs
+	 * 	Not null augend.
+	 *
+	 * @param rhs
+	 * 	Not null addend.
+	 *
+	 * @return
+	 * 	@a lhs + @a rhs.
+	 */
+	static Pointer<Number> getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs);
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers.
+	 *
+	 * @details
+	 * 	Integer minuend is passed to Number::getInverseDifference() of subtrahend. Other minuends are added to
+	 * 	negation of subtrahend.
+	 *
+	 * @param lhs
+	 * 	Not null minuend.
+	 *
+	 * @param rhs
+	 * 	Not null subtrahend.
+	 *
+	 * @return
+	 * 	@a lhs - @a rhs.
+	 */
+	static Pointer<Number> getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs);
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers.
+	 *
+	 * @param lhs
+	 * 	Not null multiplicand.
+	 *
+	 * @param rhs
+	 * 	Not null multiplier.
+	 *
+	 * @return
+	 * 	@a lhs * @a rhs.
+	 */
+	static Pointer<Number> getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs);
+
+private:
+	/**
+	 * @brief
+	 * 	True if @a Lhs has greater NumberType than @a Rhs.
+	 */
+	using IsLhsWider = std::integral_constant<bool, (NumberTraits<Lhs>::value > NumberTraits<Rhs>::value)>;
+
+	/**
+	 * @brief
+	 * 	True if @a Lhs is Integer.
+	 */
+	using IsLhsInteger = std::is_base_of<Integer, Lhs>;
+
+	/**
+	 * @{
+	 */
+
+	static Pointer<Number> getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::true_type isLhsWider);
+	static Pointer<Number> getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::false_type isLhsWider);
+	static Pointer<Number> getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::true_type isLhsInteger);
+	static Pointer<Number> getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::false_type isLhsInteger);
+	static Pointer<Number> getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::true_type isLhsWider);
+	static Pointer<Number> getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::false_type isLhsWider);
+
+	/**
+	 * @}
+	 */
+};
+
+/**
+ * @brief
+ * 	Adds numbers of any classes.
+ *
+ * @details
+ * 	Both operands are cast to their concrete classes by dispatch(), and typed getSum() is used.
+ *
+ * @param lhs
+ * 	Augend.
+ *
+ * @param rhs
+ * 	Addend.
+ *
+ * @return
+ * 	@a lhs + @a rhs.
+ */
+Pointer<Number> getSum(Pointer<Number> lhs, Pointer<Number> rhs);
+
+/**
+ * @brief
+ * 	Subtracts numbers of any classes.
+ *
+ * @details
+ * 	Both operands are cast to their concrete classes by dispatch(), and typed getDifference() is used.
+ *
+ * @param lhs
+ * 	Minuend.
+ *
+ * @param rhs
+ * 	Subtrahend.
+ *
+ * @return
+ * 	@a lhs - @a rhs.
+ */
+Pointer<Number> getDifference(Pointer<Number> lhs, Pointer<Number> rhs);
+
+/**
+ * @brief
+ * 	Multiplies numbers of any classes.
+ *
+ * @details
+ * 	Both operands are cast to their concrete classes by dispatch(), and typed getProduct() is used.
+ *
+ * @param lhs
+ * 	Multiplicand.
+ *
+ * @param rhs
+ * 	Multiplier.
+ *
+ * @return
+ * 	@a lhs * @a rhs.
+ */
+Pointer<Number> getProduct(Pointer<Number> lhs, Pointer<Number> rhs);
+
+/**
+ * @brief
+ * 	Adds numbers of concrete classes known at compile time.
+ *
+ * @param lhs
+ * 	Augend.
+ *
+ * @param rhs
+ * 	Addend.
+ *
+ * @return
+ * 	@a lhs + @a rhs.
+ */
+template<class Lhs, class Rhs>
+auto getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs)
+	-> decltype(NumberTraits<Lhs>::value, NumberTraits<Rhs>::value, Pointer<Number>());
+
+/**
+ * @brief
+ * 	Subtracts numbers of concrete classes known at compile time.
+ *
+ * @param lhs
+ * 	Minuend.
+ *
+ * @param rhs
+ * 	Subtrahend.
+ *
+ * @return
+ * 	@a lhs - @a rhs.
+ */
+template<class Lhs, class Rhs>
+auto getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs)
+	-> decltype(NumberTraits<Lhs>::value, NumberTraits<Rhs>::value, Pointer<Number>());
+
+/**
+ * @brief
+ * 	Multiplies numbers of concrete classes known at compile time.
+ *
+ * @param lhs
+ * 	Multiplicand.
+ *
+ * @param rhs
+ * 	Multiplier.
+ *
+ * @return
+ * 	@a lhs * @a rhs.
+ */
+template<class Lhs, class Rhs>
+auto getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs)
+	-> decltype(NumberTraits<Lhs>::value, NumberTraits<Rhs>::value, Pointer<Number>());
+
+template<class Function>
+auto dispatch(const Pointer<Number> &number, Function function) -> decltype(function(Pointer<Unsigned>())){
+	switch(number->getType()){
+	case NumberType::Unsigned:
+		return function(staticPointerCast<Unsigned>(number));
+	case NumberType::Signed:
+		return function(staticPointerCast<Signed>(number));
+	case NumberType::FloatingPoint:
+		return function(staticPointerCast<FloatingPoint>(number));
+	default:
+		return function(staticPointerCast<Complex>(number));
+	}
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs){
+	return getSum(lhs, rhs, IsLhsWider());
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs){
+	return getDifference(lhs, rhs, IsLhsInteger());
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs){
+	return getProduct(lhs, rhs, IsLhsWider());
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::true_type){
+	return lhs->getSum(rhs);
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::false_type){
+	//addition is commutative, so right operand may be the one doing it
+	return rhs->getSum(lhs);
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::true_type){
+	return rhs->getInverseDifference(lhs);
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::false_type){
+	return numb::getSum(staticPointerCast<Number>(lhs), rhs->getNegation());
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::true_type){
+	return lhs->getProduct(rhs);
+}
+
+template<class Lhs, class Rhs>
+Pointer<Number> TypedArithmetic<Lhs, Rhs>::getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs, std::false_type){
+	//multiplication is commutative, so right operand may be the one doing it
+	return rhs->getProduct(lhs);
+}
+
+template<class Lhs, class Rhs>
+auto getSum(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs)
+		-> decltype(NumberTraits<Lhs>::value, NumberTraits<Rhs>::value, Pointer<Number>()){
+	if(!lhs || !rhs) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return TypedArithmetic<Lhs, Rhs>::getSum(lhs, rhs);
+}
+
+template<class Lhs, class Rhs>
+auto getDifference(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs)
+		-> decltype(NumberTraits<Lhs>::value, NumberTraits<Rhs>::value, Pointer<Number>()){
+	if(!lhs || !rhs) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return TypedArithmetic<Lhs, Rhs>::getDifference(lhs, rhs);
+}
+
+template<class Lhs, class Rhs>
+auto getProduct(const Pointer<Lhs> &lhs, const Pointer<Rhs> &rhs)
+		-> decltype(NumberTraits<Lhs>::value, NumberTraits<Rhs>::value, Pointer<Number>()){
+	if(!lhs || !rhs) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	return TypedArithmetic<Lhs, Rhs>::getProduct(lhs, rhs);
+}
+
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_DISPATCH_H_ */
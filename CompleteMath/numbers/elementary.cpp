@@ -0,0 +1,633 @@
+/*
+ * elementary.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "elementary.h"
+#include "BinarySplitting.h"
+#include "Unsigned.h"
+#include "math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <mutex>
+
+namespace coma {
+namespace numb {
+
+namespace{
+
+/**
+ * @brief
+ * 	Function computing approximation of some real value.
+ *
+ * @details
+ * 	Takes working precision, returns approximation computed with about that many bits and sets last parameter
+ * 	to e such that absolute error of the approximation is not greater than 2^e.
+ */
+using Approximation = std::function<Pointer<BinaryFloat>(unsigned long long, long long &)>;
+
+/**
+ * @brief
+ * 	Function computing approximation of some real function. Works like Approximation with additional argument.
+ */
+using FunctionApproximation = std::function<Pointer<BinaryFloat>(Pointer<BinaryFloat>, unsigned long long, long long &)>;
+
+/**
+ * @brief
+ * 	Cache of approximations of a mathematical constant.
+ *
+ * @details
+ * 	Every computed approximation is stored under its precision. Request for lower precision is served by
+ * 	rounding the closest more precise approximation.
+ */
+class ConstantCache{
+public:
+	/**
+	 * @brief
+	 * 	Function computing constant with absolute error not greater than 2^-(precision + 1).
+	 */
+	using Generator = std::function<Pointer<BinaryFloat>(unsigned long long)>;
+
+	/**
+	 * @brief
+	 * 	Creates empty cache.
+	 *
+	 * @param generator
+	 * 	Function computing the constant.
+	 */
+	explicit ConstantCache(Generator generator) : m_generator{generator}{}
+
+	/**
+	 * @brief
+	 * 	Gets approximation of the constant, computing it if necessary.
+	 *
+	 * @param precision
+	 * 	Number of correct bits after the binary point.
+	 *
+	 * @return
+	 * 	Constant with absolute error lesser than 2^-@a precision. The constant is supposed to be lesser than 4.
+	 */
+	Pointer<BinaryFloat> get(unsigned long long precision){
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto found = m_values.lower_bound(precision);
+		if(found != m_values.end()) return found->second->withPrecision(precision + 6);
+		Pointer<BinaryFloat> value = m_generator(precision);
+		m_values[precision] = value;
+		return value;
+	}
+
+private:
+	/**
+	 * @brief
+	 * 	Function computing the constant.
+	 */
+	Generator m_generator;
+
+	/**
+	 * @brief
+	 * 	Computed approximations stored under their precisions.
+	 */
+	std::map<unsigned long long, Pointer<BinaryFloat>> m_values;
+
+	/**
+	 * @brief
+	 * 	Mutex guarding m_values.
+	 */
+	std::mutex m_mutex;
+};
+
+/**
+ * @brief
+ * 	Counts significant bits of a number.
+ *
+ * @param value
+ * 	Number which bits are counted.
+ *
+ * @return
+ * 	Position of the highest set bit increased by one.
+ */
+long long bitsOf(unsigned long long value) noexcept{
+	long long bits { 0 };
+	for(; value; value >>= 1) ++bits;
+	return bits;
+}
+
+/**
+ * @brief
+ * 	Chooses how many times argument is halved before summing a series.
+ *
+ * @param precision
+ * 	Working precision.
+ *
+ * @return
+ * 	About half of square root of @a precision.
+ */
+long long halvingsFor(unsigned long long precision) noexcept{
+	long long halvings { 1 };
+	while(static_cast<unsigned long long>(4 * halvings * halvings) < precision) ++halvings;
+	return halvings;
+}
+
+/**
+ * @brief
+ * 	Creates Integer with value of built-in integer.
+ *
+ * @param value
+ * 	Value of created number.
+ *
+ * @return
+ * 	Integer equal to @a value.
+ */
+Pointer<Integer> integerFromLongLong(long long value){
+	Pointer<Integer> result = Unsigned::fromUnsignedLongLong(
+			value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value));
+	return value < 0 ? staticPointerCast<Integer>(result->getNegation()) : result;
+}
+
+/**
+ * @brief
+ * 	Creates BinaryFloat with value of built-in integer.
+ *
+ * @param value
+ * 	Value of created number.
+ *
+ * @param precision
+ * 	Precision of created number.
+ *
+ * @return
+ * 	@a value rounded to nearest number of @a precision bits.
+ */
+Pointer<BinaryFloat> fromLongLong(long long value, unsigned long long precision){
+	return BinaryFloat::fromInteger(integerFromLongLong(value), precision);
+}
+
+/**
+ * @brief
+ * 	Rounds number to nearest integer, ties away from zero.
+ *
+ * @param number
+ * 	Number lesser than 2^62 in absolute value.
+ *
+ * @return
+ * 	Integer nearest to @a number.
+ */
+long long getNearest(Pointer<BinaryFloat> number){
+	Pointer<BinaryFloat> half = BinaryFloat::fromPowerOfTwo(-1, 1);
+	if(number->isNegative()) half = half->getNegation();
+	return number->withPrecision(number->getPrecision() + 2)->getSum(half)->getAsInteger()->getAsLongLong();
+}
+
+/**
+ * @brief
+ * 	Evaluates approximations with growing precision until rounding of the result is known.
+ *
+ * @details
+ * 	Implements Ziv's strategy: if both ends of the error interval around the approximation round to the same
+ * 	number, this number is correctly rounded value.
+ *
+ * @param precision
+ * 	Precision of result.
+ *
+ * @param mode
+ * 	Rounding mode of result.
+ *
+ * @param approximate
+ * 	Function computing approximations.
+ *
+ * @return
+ * 	Correctly rounded value.
+ */
+Pointer<BinaryFloat> roundCorrectly(unsigned long long precision, RoundingMode mode, const Approximation &approximate){
+	for(unsigned long long working = precision + 2 * bitsOf(precision) + 16; ; working += working / 2){
+		long long error { 0 };
+		Pointer<BinaryFloat> approximation = approximate(working, error);
+		long long magnitude { approximation->getMagnitudeExponent() };
+		if(approximation->isZero() || error > magnitude - static_cast<long long>(precision) - 2) continue;
+		long long lowest { std::min(magnitude - static_cast<long long>(approximation->getPrecision()), error) };
+		approximation = approximation->withPrecision(static_cast<unsigned long long>(magnitude + 2 - lowest));
+		Pointer<BinaryFloat> bound = BinaryFloat::fromPowerOfTwo(error, 1);
+		Pointer<BinaryFloat>
+			lower = approximation->getDifference(bound)->withPrecision(precision, mode),
+			upper = approximation->getSum(bound)->withPrecision(precision, mode);
+		if(lower->compare(upper) == CompareResult::Equal) return lower;
+	}
+}
+
+/**
+ * @brief
+ * 	Evaluates function with growing precision until rounding of the result is known.
+ *
+ * @param number
+ * 	Argument of the function. Its precision and rounding mode are used for result.
+ *
+ * @param approximate
+ * 	Function computing approximations.
+ *
+ * @return
+ * 	Correctly rounded value of the function.
+ */
+Pointer<BinaryFloat> roundCorrectly(Pointer<BinaryFloat> number, const FunctionApproximation &approximate){
+	Pointer<BinaryFloat> argument = number->withPrecision(number->getPrecision(), RoundingMode::ToNearestEven);
+	return roundCorrectly(number->getPrecision(), number->getRoundingMode(),
+			[&](unsigned long long precision, long long &error){ return approximate(argument, precision, error); });
+}
+
+/**
+ * @brief
+ * 	Computes arithmetic-geometric mean of two positive numbers.
+ *
+ * @param first
+ * 	First number.
+ *
+ * @param second
+ * 	Second number.
+ *
+ * @param precision
+ * 	Working precision.
+ *
+ * @return
+ * 	AGM(@a first, @a second) with relative error of a few units in last place.
+ */
+Pointer<BinaryFloat> getArithmeticGeometricMean(Pointer<BinaryFloat> first, Pointer<BinaryFloat> second,
+		unsigned long long precision){
+	Pointer<BinaryFloat> arithmetic = first->withPrecision(precision), geometric = second->withPrecision(precision);
+	while(true){
+		Pointer<BinaryFloat> difference = arithmetic->getDifference(geometric);
+		if(difference->isZero() || difference->getMagnitudeExponent()
+				< arithmetic->getMagnitudeExponent() - static_cast<long long>(precision / 2) - 2){
+			break;
+		}
+		Pointer<BinaryFloat> next = arithmetic->getSum(geometric)->getScaled(-1);
+		geometric = getSquareRoot(arithmetic->getProduct(geometric));
+		arithmetic = next;
+	}
+	return arithmetic->getSum(geometric)->getScaled(-1);
+}
+
+/**
+ * @brief
+ * 	Computes pi with Chudnovsky series.
+ *
+ * @param precision
+ * 	Number of correct bits after the binary point.
+ *
+ * @return
+ * 	pi with absolute error lesser than 2^-(@a precision + 1).
+ */
+Pointer<BinaryFloat> computePi(unsigned long long precision){
+	unsigned long long working { precision + 8 };
+	//factors are built from Integers, as products of k overflow 64 bits for large precisions
+	BinarySplitting series(
+			[](unsigned long long k){
+				return staticPointerCast<Integer>(Unsigned::fromUnsignedLongLong(545140134)
+						->getProduct(Unsigned::fromUnsignedLongLong(k))
+						->getSum(Unsigned::fromUnsignedLongLong(13591409)));
+			},
+			BinarySplitting::Term(),
+			[](unsigned long long k){
+				if(!k) return Pointer<Integer>(Number::ONE());
+				return staticPointerCast<Integer>(Unsigned::fromUnsignedLongLong(6 * k - 5)
+						->getProduct(Unsigned::fromUnsignedLongLong(2 * k - 1))
+						->getProduct(Unsigned::fromUnsignedLongLong(6 * k - 1))
+						->getNegation());
+			},
+			[](unsigned long long k){
+				if(!k) return Pointer<Integer>(Number::ONE());
+				Pointer<Integer> value = Unsigned::fromUnsignedLongLong(k);
+				return staticPointerCast<Integer>(value->getProduct(value)->getProduct(value)
+						->getProduct(Unsigned::fromUnsignedLongLong(10939058860032000ULL)));
+			});
+	//every term gives more than 47 bits
+	Pointer<BinaryFloat> sum = series.getSum(0, precision / 47 + 2, working);
+	return fromLongLong(426880, working)->getProduct(getSquareRoot(fromLongLong(10005, working)))->getQuotient(sum);
+}
+
+/**
+ * @brief
+ * 	Computes e as sum of inverses of factorials.
+ *
+ * @param precision
+ * 	Number of correct bits after the binary point.
+ *
+ * @return
+ * 	e with absolute error lesser than 2^-(@a precision + 1).
+ */
+Pointer<BinaryFloat> computeE(unsigned long long precision){
+	unsigned long long terms { 2 };
+	for(double bits = 0; bits < precision + 4; ++terms) bits += std::log2(static_cast<double>(terms));
+	BinarySplitting series(
+			[](unsigned long long){ return Pointer<Integer>(Number::ONE()); },
+			BinarySplitting::Term(),
+			[](unsigned long long){ return Pointer<Integer>(Number::ONE()); },
+			[](unsigned long long k){ return k ? Pointer<Integer>(Unsigned::fromUnsignedLongLong(k)) : Number::ONE(); });
+	return series.getSum(0, terms, precision + 6);
+}
+
+/**
+ * @brief
+ * 	Computes ln 2 as 2atanh(1/3).
+ *
+ * @param precision
+ * 	Number of correct bits after the binary point.
+ *
+ * @return
+ * 	ln 2 with absolute error lesser than 2^-(@a precision + 1).
+ */
+Pointer<BinaryFloat> computeLn2(unsigned long long precision){
+	unsigned long long working { precision + 6 };
+	BinarySplitting series(
+			[](unsigned long long){ return Pointer<Integer>(Number::ONE()); },
+			[](unsigned long long k){ return Pointer<Integer>(Unsigned::fromUnsignedLongLong(2 * k + 1)); },
+			[](unsigned long long){ return Pointer<Integer>(Number::ONE()); },
+			[](unsigned long long k){ return k ? Pointer<Integer>(Unsigned::fromUnsignedLongLong(9)) : Number::ONE(); });
+	//every term gives more than 3 bits
+	Pointer<BinaryFloat> sum = series.getSum(0, precision / 3 + 3, working);
+	return sum->getScaled(1)->getQuotient(fromLongLong(3, working));
+}
+
+/**
+ * @brief
+ * 	Gets cached approximation of pi.
+ *
+ * @param precision
+ * 	Number of correct bits after the binary point.
+ *
+ * @return
+ * 	pi with absolute error lesser than 2^-@a precision.
+ */
+Pointer<BinaryFloat> approximatePi(unsigned long long precision){
+	static ConstantCache cache(computePi);
+	return cache.get(precision);
+}
+
+/**
+ * @brief
+ * 	Gets cached approximation of e.
+ *
+ * @param precision
+ * 	Number of correct bits after the binary point.
+ *
+ * @return
+ * 	e with absolute error lesser than 2^-@a precision.
+ */
+Pointer<BinaryFloat> approximateE(unsigned long long precision){
+	static ConstantCache cache(computeE);
+	return cache.get(precision);
+}
+
+/**
+ * @brief
+ * 	Gets cached approximation of ln 2.
+ *
+ * @param precision
+ * 	Number of correct bits after the binary point.
+ *
+ * @return
+ * 	ln 2 with absolute error lesser than 2^-@a precision.
+ */
+Pointer<BinaryFloat> approximateLn2(unsigned long long precision){
+	static ConstantCache cache(computeLn2);
+	return cache.get(precision);
+}
+
+/**
+ * @brief
+ * 	Approximates e^@a number for non-zero @a number.
+ *
+ * @details
+ * 	Argument is reduced to r = @a number - k ln 2, then to r / 2^h, Taylor series is summed and squared h times.
+ * 	Result is multiplied by 2^k.
+ */
+Pointer<BinaryFloat> approximateExponential(Pointer<BinaryFloat> number, unsigned long long precision, long long &error){
+	long long multiple { getNearest(number->getQuotient(approximateLn2(64 + std::max(0LL, number->getMagnitudeExponent())))) };
+	unsigned long long reduced { precision + bitsOf(multiple < 0 ? 0ULL - multiple : multiple) + 8 };
+	Pointer<BinaryFloat> argument = number->withPrecision(std::max(reduced, number->getPrecision()));
+	if(multiple) argument = argument->getDifference(approximateLn2(reduced)->getProduct(fromLongLong(multiple, reduced)));
+	long long halvings { halvingsFor(precision) };
+	unsigned long long working { reduced + halvings + bitsOf(precision) + 8 };
+	argument = argument->withPrecision(working)->getScaled(-halvings);
+	Pointer<BinaryFloat> term = BinaryFloat::fromPowerOfTwo(0, working), sum = term;
+	for(long long i = 1; !term->isZero() && term->getMagnitudeExponent() > -static_cast<long long>(working); ++i){
+		term = term->getProduct(argument)->getQuotient(fromLongLong(i, working));
+		sum = sum->getSum(term);
+	}
+	for(long long i = 0; i < halvings; ++i) sum = sum->getProduct(sum);
+	sum = sum->getScaled(multiple);
+	error = sum->getMagnitudeExponent() - static_cast<long long>(precision) + 2;
+	return sum;
+}
+
+/**
+ * @brief
+ * 	Approximates ln(@a number) for positive @a number.
+ *
+ * @details
+ * 	Number is scaled to s = @a number * 2^m, where s > 2^(precision/2), and logarithm is computed from formula
+ * 	ln(@a number) = pi / (2AGM(1, 4/s)) - m ln 2.
+ */
+Pointer<BinaryFloat> approximateLogarithm(Pointer<BinaryFloat> number, unsigned long long precision, long long &error){
+	long long power { static_cast<long long>(precision / 2) + 4 - number->getMagnitudeExponent() };
+	long long powerBits { bitsOf(power < 0 ? 0ULL - power : power) };
+	unsigned long long working { precision + 2 * bitsOf(precision) + powerBits + 8 };
+	Pointer<BinaryFloat>
+		one = BinaryFloat::fromPowerOfTwo(0, working),
+		scaled = number->withPrecision(std::max(working, number->getPrecision()))->getScaled(power);
+	Pointer<BinaryFloat> mean = getArithmeticGeometricMean(one,
+			BinaryFloat::fromPowerOfTwo(2, working)->getQuotient(scaled), working);
+	Pointer<BinaryFloat> result = approximatePi(working)->getQuotient(mean->getScaled(1));
+	result = result->getDifference(approximateLn2(working)->getProduct(fromLongLong(power, working)));
+	error = powerBits + bitsOf(precision) + 2 - static_cast<long long>(precision);
+	return result;
+}
+
+/**
+ * @brief
+ * 	Approximates sine and cosine of @a number.
+ *
+ * @details
+ * 	Argument is reduced to r = @a number - k pi/2, then to r / 2^h, Taylor series of both functions are summed
+ * 	and double angle formulas are applied h times. Result is chosen according to quadrant k.
+ *
+ * @param number
+ * 	Angle, non-zero and lesser than 2^62 in absolute value.
+ *
+ * @param precision
+ * 	Working precision.
+ *
+ * @param sine
+ * 	Variable in which sine is stored.
+ *
+ * @param cosine
+ * 	Variable in which cosine is stored.
+ *
+ * @return
+ * 	e such that absolute error of both results is not greater than 2^e.
+ */
+long long approximateSineAndCosine(Pointer<BinaryFloat> number, unsigned long long precision,
+		Pointer<BinaryFloat> &sine, Pointer<BinaryFloat> &cosine){
+	long long magnitude { number->getMagnitudeExponent() }, extra { std::max(0LL, -magnitude) };
+	unsigned long long reduced { precision + std::max(0LL, magnitude) + extra + 8 };
+	Pointer<BinaryFloat> argument = number->withPrecision(std::max(reduced, number->getPrecision()));
+	Pointer<BinaryFloat> halfPi = approximatePi(reduced)->getScaled(-1);
+	long long quadrant { getNearest(argument->getQuotient(halfPi)) };
+	if(quadrant) argument = argument->getDifference(halfPi->getProduct(fromLongLong(quadrant, reduced)));
+	long long halvings { halvingsFor(precision) };
+	unsigned long long working { precision + extra + 2 * halvings + bitsOf(precision) + 8 };
+	argument = argument->withPrecision(working)->getScaled(-halvings);
+	Pointer<BinaryFloat>
+		square = argument->getProduct(argument)->getNegation(),
+		sineTerm = argument,
+		cosineTerm = BinaryFloat::fromPowerOfTwo(0, working);
+	sine = sineTerm;
+	cosine = cosineTerm;
+	for(long long i = 1; !cosineTerm->isZero() && cosineTerm->getMagnitudeExponent() > -static_cast<long long>(working); ++i){
+		cosineTerm = cosineTerm->getProduct(square)->getQuotient(fromLongLong((2 * i - 1) * 2 * i, working));
+		sineTerm = sineTerm->getProduct(square)->getQuotient(fromLongLong(2 * i * (2 * i + 1), working));
+		cosine = cosine->getSum(cosineTerm);
+		sine = sine->getSum(sineTerm);
+	}
+	Pointer<BinaryFloat> one = BinaryFloat::fromPowerOfTwo(0, working);
+	for(long long i = 0; i < halvings; ++i){
+		Pointer<BinaryFloat> doubled = sine->getProduct(cosine)->getScaled(1);
+		cosine = one->getDifference(sine->getProduct(sine)->getScaled(1));
+		sine = doubled;
+	}
+	long long quarter { ((quadrant % 4) + 4) % 4 };
+	if(quarter % 2){
+		std::swap(sine, cosine);
+		cosine = cosine->getNegation();
+	}
+	if(quarter >= 2){
+		sine = sine->getNegation();
+		cosine = cosine->getNegation();
+	}
+	return 2 - static_cast<long long>(precision + extra);
+}
+
+/**
+ * @brief
+ * 	Approximates atan(@a number) for non-zero @a number.
+ *
+ * @details
+ * 	Absolute value of argument is reduced to [0, 1] with formula atan(x) = pi/2 - atan(1/x) and halved h times
+ * 	with formula atan(x) = 2atan(x / (1 + sqrt(1 + x^2))). Then Taylor series is summed and multiplied by 2^h.
+ */
+Pointer<BinaryFloat> approximateArcTangent(Pointer<BinaryFloat> number, unsigned long long precision, long long &error){
+	long long halvings { halvingsFor(precision) };
+	Pointer<BinaryFloat> argument = number->getAbsoluteValue();
+	bool inverted { argument->getMagnitudeExponent() > 1 };
+	long long extra { std::max(0LL, -argument->getMagnitudeExponent()) };
+	unsigned long long working { precision + extra + halvings + 2 * bitsOf(precision) + 10 };
+	Pointer<BinaryFloat> one = BinaryFloat::fromPowerOfTwo(0, working);
+	argument = argument->withPrecision(std::max(working, argument->getPrecision()));
+	if(inverted) argument = one->getQuotient(argument);
+	for(long long i = 0; i < halvings; ++i){
+		Pointer<BinaryFloat> root = getSquareRoot(one->getSum(argument->getProduct(argument)));
+		argument = argument->getQuotient(one->getSum(root));
+	}
+	Pointer<BinaryFloat>
+		square = argument->getProduct(argument)->getNegation(),
+		power = argument,
+		sum = argument;
+	for(long long i = 1; !power->isZero() && power->getMagnitudeExponent() > -static_cast<long long>(working); ++i){
+		power = power->getProduct(square);
+		sum = sum->getSum(power->getQuotient(fromLongLong(2 * i + 1, working)));
+	}
+	sum = sum->getScaled(halvings);
+	if(inverted) sum = approximatePi(working)->getScaled(-1)->getDifference(sum);
+	if(number->isNegative()) sum = sum->getNegation();
+	error = 2 - static_cast<long long>(precision + extra);
+	return sum;
+}
+}
+
+Pointer<BinaryFloat> getSquareRoot(Pointer<BinaryFloat> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(number->isNegative()) REPORT_ERROR(std::exception("Square root of negative number exception"), nullptr);
+	if(number->isZero()) return number;
+	unsigned long long precision { number->getPrecision() };
+	long long exponent { number->getMagnitudeExponent() - static_cast<long long>(precision) };
+	unsigned long long shift { precision + 4 };
+	if((exponent - static_cast<long long>(shift)) % 2) ++shift;
+	Pointer<Integer> mantissa = number->getScaled(static_cast<long long>(precision) - number->getMagnitudeExponent())
+			->getAsInteger()->getShiftedLeft(shift);
+	Pointer<Integer> root = getIntegerSquareRoot(mantissa);
+	bool inexact { mantissa->compare(staticPointerCast<RealNumber>(root->getProduct(root))) != CompareResult::Equal };
+	root = root->getShiftedLeft(1);
+	if(inexact) root = staticPointerCast<Integer>(root->getSum(Number::ONE()));
+	return BinaryFloat::fromInteger(root, precision, number->getRoundingMode())
+			->getScaled((exponent - static_cast<long long>(shift)) / 2 - 1);
+}
+
+Pointer<BinaryFloat> getPi(unsigned long long precision, RoundingMode roundingMode){
+	return roundCorrectly(precision, roundingMode, [](unsigned long long working, long long &error){
+		error = -static_cast<long long>(working);
+		return approximatePi(working);
+	});
+}
+
+Pointer<BinaryFloat> getE(unsigned long long precision, RoundingMode roundingMode){
+	return roundCorrectly(precision, roundingMode, [](unsigned long long working, long long &error){
+		error = -static_cast<long long>(working);
+		return approximateE(working);
+	});
+}
+
+Pointer<BinaryFloat> getLn2(unsigned long long precision, RoundingMode roundingMode){
+	return roundCorrectly(precision, roundingMode, [](unsigned long long working, long long &error){
+		error = -static_cast<long long>(working);
+		return approximateLn2(working);
+	});
+}
+
+Pointer<BinaryFloat> getExponential(Pointer<BinaryFloat> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(number->getMagnitudeExponent() > 62) REPORT_ERROR(std::exception("Overflow exception"), nullptr);
+	if(number->isZero()) return BinaryFloat::fromPowerOfTwo(0, number->getPrecision(), number->getRoundingMode());
+	return roundCorrectly(number, approximateExponential);
+}
+
+Pointer<BinaryFloat> getLogarithm(Pointer<BinaryFloat> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(!number->isPositive()) REPORT_ERROR(std::exception("Logarithm of non-positive number exception"), nullptr);
+	if(number->compare(BinaryFloat::fromPowerOfTwo(0, 1)) == CompareResult::Equal){
+		return BinaryFloat::fromInteger(Number::ZERO(), number->getPrecision(), number->getRoundingMode());
+	}
+	return roundCorrectly(number, approximateLogarithm);
+}
+
+Pointer<BinaryFloat> getSine(Pointer<BinaryFloat> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(number->getMagnitudeExponent() > 62) REPORT_ERROR(std::exception("Overflow exception"), nullptr);
+	if(number->isZero()) return number;
+	return roundCorrectly(number, [](Pointer<BinaryFloat> argument, unsigned long long precision, long long &error){
+		Pointer<BinaryFloat> sine, cosine;
+		error = approximateSineAndCosine(argument, precision, sine, cosine);
+		return sine;
+	});
+}
+
+Pointer<BinaryFloat> getCosine(Pointer<BinaryFloat> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(number->getMagnitudeExponent() > 62) REPORT_ERROR(std::exception("Overflow exception"), nullptr);
+	if(number->isZero()) return BinaryFloat::fromPowerOfTwo(0, number->getPrecision(), number->getRoundingMode());
+	return roundCorrectly(number, [](Pointer<BinaryFloat> argument, unsigned long long precision, long long &error){
+		Pointer<BinaryFloat> sine, cosine;
+		error = approximateSineAndCosine(argument, precision, sine, cosine);
+		return cosine;
+	});
+}
+
+Pointer<BinaryFloat> getArcTangent(Pointer<BinaryFloat> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(number->isZero()) return number;
+	return roundCorrectly(number, approximateArcTangent);
+}
+
+} /* namespace numb */
+} /* namespace coma */
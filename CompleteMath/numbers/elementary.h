@@ -0,0 +1,170 @@
+/*
+ * elementary.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_ELEMENTARY_H_
+#define NUMBERS_ELEMENTARY_H_
+
+#include "BinaryFloat.h"
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Computes pi with Chudnovsky series evaluated by binary splitting.
+ *
+ * @details
+ * 	Approximations are cached, so following requests for the same or lower precision are cheap.
+ *
+ * @param precision
+ * 	Precision of result.
+ *
+ * @param roundingMode
+ * 	Rounding mode of result.
+ *
+ * @return
+ * 	pi correctly rounded to @a precision bits.
+ */
+Pointer<BinaryFloat> getPi(unsigned long long precision, RoundingMode roundingMode = RoundingMode::ToNearestEven);
+
+/**
+ * @brief
+ * 	Computes e as sum of inverses of factorials evaluated by binary splitting.
+ *
+ * @details
+ * 	Approximations are cached, so following requests for the same or lower precision are cheap.
+ *
+ * @param precision
+ * 	Precision of result.
+ *
+ * @param roundingMode
+ * 	Rounding mode of result.
+ *
+ * @return
+ * 	e correctly rounded to @a precision bits.
+ */
+Pointer<BinaryFloat> getE(unsigned long long precision, RoundingMode roundingMode = RoundingMode::ToNearestEven);
+
+/**
+ * @brief
+ * 	Computes ln 2 as 2atanh(1/3) evaluated by binary splitting.
+ *
+ * @details
+ * 	Approximations are cached, so following requests for the same or lower precision are cheap.
+ *
+ * @param precision
+ * 	Precision of result.
+ *
+ * @param roundingMode
+ * 	Rounding mode of result.
+ *
+ * @return
+ * 	ln 2 correctly rounded to @a precision bits.
+ */
+Pointer<BinaryFloat> getLn2(unsigned long long precision, RoundingMode roundingMode = RoundingMode::ToNearestEven);
+
+/**
+ * @brief
+ * 	Computes square root of given number.
+ *
+ * @details
+ * 	Result is correctly rounded to precision of @a number using its rounding mode.
+ *
+ * @param number
+ * 	Non-negative number.
+ *
+ * @return
+ * 	Square root of @a number.
+ */
+Pointer<BinaryFloat> getSquareRoot(Pointer<BinaryFloat> number);
+
+/**
+ * @brief
+ * 	Computes e raised to given power.
+ *
+ * @details
+ * 	Result is correctly rounded to precision of @a number using its rounding mode. Argument is reduced by
+ * 	multiple of ln 2 and halved before summing Taylor series, then the sum is squared back.
+ *
+ * @param number
+ * 	Exponent, lesser than 2^62 in absolute value.
+ *
+ * @return
+ * 	e^@a number.
+ */
+Pointer<BinaryFloat> getExponential(Pointer<BinaryFloat> number);
+
+/**
+ * @brief
+ * 	Computes natural logarithm of given number.
+ *
+ * @details
+ * 	Result is correctly rounded to precision of @a number using its rounding mode. Logarithm is evaluated with
+ * 	arithmetic-geometric mean, so its cost is dominated by a few dozens of square roots. Constants pi and ln 2
+ * 	are taken from cache.
+ *
+ * @param number
+ * 	Positive number.
+ *
+ * @return
+ * 	ln(@a number).
+ */
+Pointer<BinaryFloat> getLogarithm(Pointer<BinaryFloat> number);
+
+/**
+ * @brief
+ * 	Computes sine of given number.
+ *
+ * @details
+ * 	Result is correctly rounded to precision of @a number using its rounding mode. Argument is reduced modulo
+ * 	pi/2 and halved before summing Taylor series, then double angle formulas are applied.
+ *
+ * @param number
+ * 	Angle in radians, lesser than 2^62 in absolute value.
+ *
+ * @return
+ * 	sin(@a number).
+ */
+Pointer<BinaryFloat> getSine(Pointer<BinaryFloat> number);
+
+/**
+ * @brief
+ * 	Computes cosine of given number.
+ *
+ * @details
+ * 	Result is correctly rounded to precision of @a number using its rounding mode. Evaluated the same way as
+ * 	getSine().
+ *
+ * @param number
+ * 	Angle in radians, lesser than 2^62 in absolute value.
+ *
+ * @return
+ * 	cos(@a number).
+ */
+Pointer<BinaryFloat> getCosine(Pointer<BinaryFloat> number);
+
+/**
+ * @brief
+ * 	Computes arcus tangent of given number.
+ *
+ * @details
+ * 	Result is correctly rounded to precision of @a number using its rounding mode. Argument is reduced to
+ * 	[0, 1] and halved several times with formula atan(x) = 2atan(x / (1 + sqrt(1 + x^2))) before summing
+ * 	Taylor series.
+ *
+ * @param number
+ * 	Any number.
+ *
+ * @return
+ * 	atan(@a number) in range (-pi/2, pi/2).
+ */
+Pointer<BinaryFloat> getArcTangent(Pointer<BinaryFloat> number);
+
+}  // namespace numb
+}  // namespace coma
+
+#endif /* NUMBERS_ELEMENTARY_H_ */
@@ -0,0 +1,957 @@
+/*
+ * factorization.cpp
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#include "factorization.h"
+#include "math.h"
+#include "Unsigned.h"
+
+#include "../Technical/Concurrency.h"
+#include "../Technical/TaskGroup.h"
+#include "../Utility/ArrayArithmetic.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace coma {
+namespace numb {
+
+namespace{
+
+/**
+ * @brief
+ * 	Number stored in little-endian 64 bit words.
+ */
+using Words = std::vector<unsigned long long>;
+
+/**
+ * @brief
+ * 	Bound of primes used for trial division.
+ */
+const unsigned long long TRIAL_DIVISION_LIMIT { 1ull << 16 };
+
+/**
+ * @brief
+ * 	Number of steps of rho method between computations of GCD.
+ */
+const unsigned long long RHO_BATCH { 128 };
+
+/**
+ * @brief
+ * 	Number of steps of rho method after which elliptic curve method is used instead.
+ */
+const unsigned long long RHO_LIMIT { 1ull << 18 };
+
+/**
+ * @brief
+ * 	Number of precomputed points in stage 2 of elliptic curve method.
+ */
+const unsigned long long ECM_STAGE_TWO_POINTS { 50 };
+
+/**
+ * @brief
+ * 	Computes product of two words increased by two words.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor.
+ *
+ * @param addend
+ * 	Word added to the product.
+ *
+ * @param carry
+ * 	Word added to the product, replaced by the more significant word of the result.
+ *
+ * @return
+ * 	The less significant word of @a lhs * @a rhs + @a addend + @a carry.
+ */
+unsigned long long multiplyAdd(unsigned long long lhs, unsigned long long rhs, unsigned long long addend,
+		unsigned long long &carry){
+#if defined(__SIZEOF_INT128__)
+	//inlined here, as this is the innermost loop of modular multiplication
+	unsigned __int128 result { static_cast<unsigned __int128>(lhs) * rhs + addend + carry };
+	carry = static_cast<unsigned long long>(result >> 64);
+	return static_cast<unsigned long long>(result);
+#else
+	unsigned long long high, low;
+	util::multiplyWords(lhs, rhs, high, low);
+	low += addend;
+	high += low < addend ? 1 : 0;
+	low += carry;
+	high += low < carry ? 1 : 0;
+	carry = high;
+	return low;
+#endif
+}
+
+/**
+ * @brief
+ * 	Compares numbers stored in words of the same length.
+ *
+ * @param lhs
+ * 	First number.
+ *
+ * @param rhs
+ * 	Second number.
+ *
+ * @return
+ * 	Negative value if @a lhs < @a rhs, zero if they are equal and positive value otherwise.
+ */
+int compare(const Words &lhs, const Words &rhs){
+	for(std::size_t i = lhs.size(); i-- > 0;){
+		if(lhs[i] != rhs[i]) return lhs[i] < rhs[i] ? -1 : 1;
+	}
+	return 0;
+}
+
+/**
+ * @brief
+ * 	Checks if number stored in words is zero.
+ *
+ * @param number
+ * 	Number to check.
+ *
+ * @return
+ * 	True if all words are zero. Else returns false.
+ */
+bool isZero(const Words &number){
+	return std::all_of(number.begin(), number.end(), [](unsigned long long word){ return !word; });
+}
+
+/**
+ * @brief
+ * 	Shifts number stored in words right by given amount of bits lesser than 64.
+ *
+ * @param number
+ * 	Number to shift in place.
+ *
+ * @param bits
+ * 	Number of bits.
+ */
+void shiftRight(Words &number, unsigned bits){
+	if(!bits) return;
+	for(std::size_t i = 0; i < number.size(); ++i){
+		number[i] = (number[i] >> bits) | (i + 1 < number.size() ? number[i + 1] << (64 - bits) : 0);
+	}
+}
+
+/**
+ * @brief
+ * 	Converts words to Integer.
+ *
+ * @param words
+ * 	Words of number.
+ *
+ * @return
+ * 	Non-negative Integer stored in @a words.
+ */
+Pointer<Integer> getInteger(const Words &words){
+	tech::RuntimeArray<unsigned char> array(8 * words.size());
+	for(std::size_t i = 0; i < array.length(); ++i){
+		array[i] = static_cast<unsigned char>(words[i / 8] >> (8 * (i % 8)));
+	}
+	return Unsigned::fromLittleEndianArray(array);
+}
+
+/**
+ * @brief
+ * 	Finds greatest common divisor of numbers stored in words with binary algorithm.
+ *
+ * @param lhs
+ * 	First number.
+ *
+ * @param rhs
+ * 	Second number, odd.
+ *
+ * @return
+ * 	gcd(@a lhs, @a rhs).
+ */
+Words getCommonDivisor(Words lhs, Words rhs){
+	while(!isZero(lhs)){
+		unsigned zeros { 0 };
+		while(!lhs[zeros / 64]) zeros += 64;
+		while(!((lhs[zeros / 64] >> (zeros % 64)) & 1)) ++zeros;
+		for(; zeros >= 64; zeros -= 64){
+			std::rotate(lhs.begin(), lhs.begin() + 1, lhs.end());
+			lhs.back() = 0;
+		}
+		shiftRight(lhs, zeros);
+		if(compare(lhs, rhs) < 0) std::swap(lhs, rhs);
+		util::subtractWords(lhs.data(), rhs.data(), lhs.size());
+	}
+	return rhs;
+}
+
+/**
+ * @brief
+ * 	Checks if number stored in words is one.
+ *
+ * @param number
+ * 	Number to check.
+ *
+ * @return
+ * 	True if @a number equals one. Else returns false.
+ */
+bool isOne(const Words &number){
+	return number[0] == 1 && std::all_of(number.begin() + 1, number.end(), [](unsigned long long word){ return !word; });
+}
+
+}
+
+/**
+ * @brief
+ * 	Modular arithmetic in Montgomery form for odd modulus.
+ *
+ * @details
+ * 	Residue x is stored as x * 2^(64k) mod n in k words, where k is length of modulus n. Multiplication is
+ * 	interleaved with reduction word by word (CIOS), so it needs neither division nor temporary of double length.
+ * 	All operations write to words of residues given by caller, which are allocated once with getZero(), so they
+ * 	allocate no memory. Integers are created only when converting to and from Montgomery form.
+ *
+ * 	Class is outside of anonymous namespace, as it reads words of Integers directly.
+ */
+class MontgomeryArithmetic {
+public:
+	/**
+	 * @brief
+	 * 	Prepares arithmetic for given modulus.
+	 *
+	 * @param modulus
+	 * 	Odd modulus greater than one.
+	 */
+	explicit MontgomeryArithmetic(Pointer<Integer> modulus) :
+			m_modulus{modulus},
+			m_words{getWords(modulus, (modulus->getBitLength() + 63) / 64)},
+			m_inverse{1},
+			m_one{}{
+		//Newton iteration doubles number of correct bits of inverse of modulus modulo 2^64
+		for(int i = 0; i < 6; ++i) m_inverse *= 2 - m_words[0] * m_inverse;
+		m_inverse = 0 - m_inverse;
+		m_one = getForm(Number::ONE());
+	}
+
+	/**
+	 * @brief
+	 * 	Converts number to Montgomery form.
+	 *
+	 * @param number
+	 * 	Non-negative number.
+	 *
+	 * @return
+	 * 	@a number * 2^(64k) mod n.
+	 */
+	Words getForm(Pointer<Integer> number) const{
+		Pointer<Integer> shifted = number->getShiftedLeft(64 * m_words.size());
+		return getWords(staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(shifted)->getRemainder(m_modulus),
+				m_words.size());
+	}
+
+	/**
+	 * @brief
+	 * 	Multiplies numbers in Montgomery form.
+	 *
+	 * @param lhs
+	 * 	First factor.
+	 *
+	 * @param rhs
+	 * 	Second factor.
+	 *
+	 * @param result
+	 * 	Variable for @a lhs * @a rhs mod n, may be the same object as one of factors.
+	 */
+	void multiply(const Words &lhs, const Words &rhs, Words &result) const{
+		std::size_t length { m_words.size() };
+		//result may be a factor, so sum is accumulated apart, with two most significant words in variables
+		thread_local Words sum;
+		sum.assign(length, 0);
+		unsigned long long top { 0 }, overflow { 0 };
+		for(std::size_t i = 0; i < length; ++i){
+			unsigned long long carry { 0 };
+			for(std::size_t j = 0; j < length; ++j) sum[j] = multiplyAdd(lhs[j], rhs[i], sum[j], carry);
+			top += carry;
+			overflow = top < carry ? 1 : 0;
+			//adding multiple of modulus which zeroes the least significant word, then dropping it
+			unsigned long long factor { sum[0] * m_inverse };
+			carry = 0;
+			multiplyAdd(factor, m_words[0], sum[0], carry);
+			for(std::size_t j = 1; j < length; ++j) sum[j - 1] = multiplyAdd(factor, m_words[j], sum[j], carry);
+			sum[length - 1] = top + carry;
+			top = overflow + (sum[length - 1] < carry ? 1 : 0);
+		}
+		if(top || compare(sum, m_words) >= 0) util::subtractWords(sum.data(), m_words.data(), length);
+		std::copy(sum.begin(), sum.end(), result.begin());
+	}
+
+	/**
+	 * @brief
+	 * 	Adds numbers in Montgomery form.
+	 *
+	 * @param lhs
+	 * 	First summand.
+	 *
+	 * @param rhs
+	 * 	Second summand.
+	 *
+	 * @param result
+	 * 	Variable for @a lhs + @a rhs mod n, may be the same object as one of summands.
+	 */
+	void add(const Words &lhs, const Words &rhs, Words &result) const{
+		unsigned long long carry { 0 };
+		for(std::size_t i = 0; i < m_words.size(); ++i){
+			unsigned long long left { lhs[i] }, sum { left + rhs[i] }, next { sum < left ? 1ull : 0ull };
+			result[i] = sum + carry;
+			carry = next + (result[i] < carry ? 1 : 0);
+		}
+		if(carry || compare(result, m_words) >= 0) util::subtractWords(result.data(), m_words.data(), m_words.size());
+	}
+
+	/**
+	 * @brief
+	 * 	Subtracts numbers in Montgomery form.
+	 *
+	 * @param lhs
+	 * 	Minuend.
+	 *
+	 * @param rhs
+	 * 	Subtrahend.
+	 *
+	 * @param result
+	 * 	Variable for @a lhs - @a rhs mod n, may be the same object as one of operands.
+	 */
+	void subtract(const Words &lhs, const Words &rhs, Words &result) const{
+		unsigned long long borrow { 0 };
+		for(std::size_t i = 0; i < m_words.size(); ++i){
+			unsigned long long left { lhs[i] }, right { rhs[i] }, difference { left - right };
+			unsigned long long next { left < right ? 1ull : 0ull };
+			result[i] = difference - borrow;
+			borrow = next + (difference < borrow ? 1 : 0);
+		}
+		if(borrow) util::addWords(result.data(), m_words.data(), m_words.size());
+	}
+
+	/**
+	 * @brief
+	 * 	Finds common divisor of residue and modulus.
+	 *
+	 * @details
+	 * 	Montgomery factor is coprime to modulus, so residue may be passed in Montgomery form.
+	 *
+	 * @param residue
+	 * 	Residue.
+	 *
+	 * @return
+	 * 	gcd(@a residue, n) as words.
+	 */
+	Words getGCD(const Words &residue) const{
+		return getCommonDivisor(residue, m_words);
+	}
+
+	/**
+	 * @brief
+	 * 	Gets zero, which is also words for result of operations.
+	 *
+	 * @return
+	 * 	k zero words.
+	 */
+	Words getZero() const{
+		return Words(m_words.size(), 0);
+	}
+
+	/**
+	 * @brief
+	 * 	Gets one in Montgomery form.
+	 *
+	 * @return
+	 * 	2^(64k) mod n.
+	 */
+	const Words &getOne() const noexcept{
+		return m_one;
+	}
+
+	/**
+	 * @brief
+	 * 	Gets modulus.
+	 *
+	 * @return
+	 * 	Modulus as words.
+	 */
+	const Words &getModulus() const noexcept{
+		return m_words;
+	}
+
+private:
+	/**
+	 * @brief
+	 * 	Converts non-negative Integer to words.
+	 *
+	 * @param number
+	 * 	Non-negative number.
+	 *
+	 * @param length
+	 * 	Number of words, large enough for @a number.
+	 *
+	 * @return
+	 * 	Words of @a number.
+	 */
+	static Words getWords(Pointer<Integer> number, std::size_t length){
+		const tech::RuntimeArray<unsigned char> &array = number->getArray();
+		Words words(length, 0);
+		for(std::size_t i = 0; i < std::min<std::size_t>(array.length(), 8 * length); ++i){
+			words[i / 8] |= static_cast<unsigned long long>(array[i]) << (8 * (i % 8));
+		}
+		return words;
+	}
+
+	/**
+	 * @brief
+	 * 	Modulus.
+	 */
+	Pointer<Integer> m_modulus;
+
+	/**
+	 * @brief
+	 * 	Words of modulus.
+	 */
+	Words m_words;
+
+	/**
+	 * @brief
+	 * 	-n^(-1) mod 2^64.
+	 */
+	unsigned long long m_inverse;
+
+	/**
+	 * @brief
+	 * 	One in Montgomery form.
+	 */
+	Words m_one;
+};
+
+namespace{
+
+/**
+ * @brief
+ * 	Checks if divisor is a proper one.
+ *
+ * @param divisor
+ * 	Divisor of modulus.
+ *
+ * @param arithmetic
+ * 	Arithmetic of modulus.
+ *
+ * @return
+ * 	True if @a divisor is neither one nor modulus. Else returns false.
+ */
+bool isProperDivisor(const Words &divisor, const MontgomeryArithmetic &arithmetic){
+	return !isOne(divisor) && compare(divisor, arithmetic.getModulus()) != 0;
+}
+
+/**
+ * @brief
+ * 	Looks for divisor with Pollard-Brent rho method.
+ *
+ * @details
+ * 	Iterates x -> x^2 + c with Brent's cycle detection. Differences are multiplied in batches, so GCD is
+ * 	computed once per RHO_BATCH steps; if the batch hits modulus, its steps are repeated one by one.
+ *
+ * @param arithmetic
+ * 	Arithmetic of odd composite modulus.
+ *
+ * @param increment
+ * 	Constant c of iterated polynomial.
+ *
+ * @param limit
+ * 	Maximal number of steps.
+ *
+ * @return
+ * 	Proper divisor of modulus or empty vector if none was found.
+ */
+Words getDivisorByRho(const MontgomeryArithmetic &arithmetic, unsigned long long increment, unsigned long long limit){
+	Words
+		c = arithmetic.getForm(Unsigned::fromUnsignedLongLong(increment)),
+		y = arithmetic.getZero(),
+		x = arithmetic.getZero(),
+		saved = arithmetic.getZero(),
+		difference = arithmetic.getZero(),
+		product = arithmetic.getOne(),
+		divisor = arithmetic.getZero();
+	divisor[0] = 1;
+	arithmetic.add(arithmetic.getOne(), arithmetic.getOne(), y);
+	auto step = [&arithmetic, &c](Words &value){
+		arithmetic.multiply(value, value, value);
+		arithmetic.add(value, c, value);
+	};
+	unsigned long long steps { 0 };
+	for(unsigned long long range = 1; steps < limit && isOne(divisor); range *= 2){
+		x = y;
+		for(unsigned long long i = 0; i < range; ++i) step(y);
+		for(unsigned long long done = 0; done < range && isOne(divisor); done += RHO_BATCH){
+			saved = y;
+			for(unsigned long long i = 0; i < std::min(RHO_BATCH, range - done); ++i){
+				step(y);
+				arithmetic.subtract(x, y, difference);
+				arithmetic.multiply(product, difference, product);
+			}
+			divisor = arithmetic.getGCD(product);
+			steps += RHO_BATCH;
+		}
+	}
+	if(!isZero(product) && compare(divisor, arithmetic.getModulus())) return isOne(divisor) ? Words() : divisor;
+	//batch skipped over the divisor, so it is repeated step by step
+	do{
+		step(saved);
+		arithmetic.subtract(x, saved, difference);
+		divisor = arithmetic.getGCD(difference);
+	}while(isOne(divisor));
+	return isProperDivisor(divisor, arithmetic) ? divisor : Words();
+}
+
+/**
+ * @brief
+ * 	Point of Montgomery curve in projective coordinates X:Z.
+ */
+struct Point{
+	/**
+	 * @brief
+	 * 	X coordinate.
+	 */
+	Words x;
+
+	/**
+	 * @brief
+	 * 	Z coordinate.
+	 */
+	Words z;
+};
+
+/**
+ * @brief
+ * 	Arithmetic of points of Montgomery curve By^2 = x^3 + Ax^2 + x.
+ *
+ * @details
+ * 	Temporaries of operations are allocated once per curve, so operations on points allocate no memory.
+ */
+class CurveArithmetic {
+public:
+	/**
+	 * @brief
+	 * 	Prepares arithmetic of curve given by (A + 2) / 4.
+	 *
+	 * @param arithmetic
+	 * 	Arithmetic of modulus.
+	 *
+	 * @param numerator
+	 * 	Numerator of (A + 2) / 4.
+	 *
+	 * @param denominator
+	 * 	Denominator of (A + 2) / 4.
+	 */
+	CurveArithmetic(const MontgomeryArithmetic &arithmetic, Words numerator, Words denominator) :
+			m_arithmetic(arithmetic),
+			m_numerator{std::move(numerator)},
+			m_denominator{std::move(denominator)},
+			m_first{arithmetic.getZero()},
+			m_second{arithmetic.getZero()},
+			m_third{arithmetic.getZero()},
+			m_low{arithmetic.getZero(), arithmetic.getZero()},
+			m_high{arithmetic.getZero(), arithmetic.getZero()}{}
+
+	/**
+	 * @brief
+	 * 	Gets zero point, which is also variable for results of operations.
+	 *
+	 * @return
+	 * 	Point with zero coordinates.
+	 */
+	Point getZero() const{
+		return Point { m_arithmetic.getZero(), m_arithmetic.getZero() };
+	}
+
+	/**
+	 * @brief
+	 * 	Doubles point of curve.
+	 *
+	 * @param point
+	 * 	Point to double.
+	 *
+	 * @param result
+	 * 	Variable for 2@a point, may be the same object as @a point.
+	 */
+	void doublePoint(const Point &point, Point &result){
+		m_arithmetic.add(point.x, point.z, m_first);
+		m_arithmetic.subtract(point.x, point.z, m_second);
+		m_arithmetic.multiply(m_first, m_first, m_first);
+		m_arithmetic.multiply(m_second, m_second, m_second);
+		//4XZ and (X - Z)^2 multiplied by denominator
+		m_arithmetic.subtract(m_first, m_second, m_third);
+		m_arithmetic.multiply(m_second, m_denominator, m_second);
+		m_arithmetic.multiply(m_first, m_second, result.x);
+		m_arithmetic.multiply(m_third, m_numerator, m_first);
+		m_arithmetic.add(m_second, m_first, m_first);
+		m_arithmetic.multiply(m_third, m_first, result.z);
+	}
+
+	/**
+	 * @brief
+	 * 	Adds points of curve knowing their difference.
+	 *
+	 * @param lhs
+	 * 	First point.
+	 *
+	 * @param rhs
+	 * 	Second point.
+	 *
+	 * @param difference
+	 * 	@a lhs - @a rhs.
+	 *
+	 * @param result
+	 * 	Variable for @a lhs + @a rhs, may be the same object as any of operands.
+	 */
+	void addPoints(const Point &lhs, const Point &rhs, const Point &difference, Point &result){
+		m_arithmetic.subtract(lhs.x, lhs.z, m_first);
+		m_arithmetic.add(rhs.x, rhs.z, m_second);
+		m_arithmetic.multiply(m_first, m_second, m_first);
+		m_arithmetic.add(lhs.x, lhs.z, m_second);
+		m_arithmetic.subtract(rhs.x, rhs.z, m_third);
+		m_arithmetic.multiply(m_second, m_third, m_second);
+		m_arithmetic.add(m_first, m_second, m_third);
+		m_arithmetic.subtract(m_first, m_second, m_first);
+		m_arithmetic.multiply(m_third, m_third, m_third);
+		m_arithmetic.multiply(m_first, m_first, m_first);
+		//X of result is kept apart until Z, which reads difference, is done
+		m_arithmetic.multiply(difference.z, m_third, m_third);
+		m_arithmetic.multiply(difference.x, m_first, result.z);
+		std::swap(result.x, m_third);
+	}
+
+	/**
+	 * @brief
+	 * 	Multiplies point of curve by scalar with Montgomery ladder.
+	 *
+	 * @param point
+	 * 	Point to multiply.
+	 *
+	 * @param scalar
+	 * 	Positive scalar.
+	 *
+	 * @param result
+	 * 	Variable for @a scalar * @a point, may be the same object as @a point.
+	 */
+	void multiplyPoint(const Point &point, unsigned long long scalar, Point &result){
+		//invariant: high = low + point
+		m_low = point;
+		doublePoint(point, m_high);
+		int bit { 63 };
+		while(!((scalar >> bit) & 1)) --bit;
+		while(bit-- > 0){
+			if((scalar >> bit) & 1){
+				addPoints(m_high, m_low, point, m_low);
+				doublePoint(m_high, m_high);
+			}else{
+				addPoints(m_high, m_low, point, m_high);
+				doublePoint(m_low, m_low);
+			}
+		}
+		result = m_low;
+	}
+
+private:
+	/**
+	 * @brief
+	 * 	Arithmetic of modulus.
+	 */
+	const MontgomeryArithmetic &m_arithmetic;
+
+	/**
+	 * @brief
+	 * 	Numerator of (A + 2) / 4.
+	 */
+	Words m_numerator;
+
+	/**
+	 * @brief
+	 * 	Denominator of (A + 2) / 4.
+	 */
+	Words m_denominator;
+
+	/**
+	 * @{
+	 * @brief
+	 * 	Temporaries of operations.
+	 */
+
+	Words m_first;
+	Words m_second;
+	Words m_third;
+	Point m_low;
+	Point m_high;
+
+	/**
+	 * @}
+	 */
+};
+
+/**
+ * @brief
+ * 	Looks for divisor with one curve of elliptic curve method.
+ *
+ * @details
+ * 	Curve and its point are chosen with Suyama's parametrization, so order of the curve is divisible by 12.
+ * 	Stage 1 multiplies the point by all prime powers up to @a bound. Stage 2 looks for one more prime up to
+ * 	100 * @a bound with precomputed multiples of the point, at cost of about one multiplication per prime.
+ *
+ * @param arithmetic
+ * 	Arithmetic of odd composite modulus.
+ *
+ * @param sigma
+ * 	Parameter of curve, greater than 5.
+ *
+ * @param bound
+ * 	Stage 1 bound, greater than 2 * ECM_STAGE_TWO_POINTS.
+ *
+ * @param primes
+ * 	All primes up to 100 * @a bound.
+ *
+ * @return
+ * 	Proper divisor of modulus or empty vector if none was found.
+ */
+Words getDivisorByCurve(const MontgomeryArithmetic &arithmetic, unsigned long long sigma, unsigned long long bound,
+		const std::vector<unsigned long long> &primes){
+	auto getForm = [&arithmetic](unsigned long long value){
+		return arithmetic.getForm(Unsigned::fromUnsignedLongLong(value));
+	};
+	Words
+		s = getForm(sigma),
+		u = getForm(5),
+		v = getForm(4),
+		uCube = arithmetic.getZero(),
+		difference = arithmetic.getZero(),
+		numerator = getForm(3),
+		denominator = getForm(16);
+	arithmetic.multiply(v, s, v);
+	arithmetic.multiply(s, s, s);
+	arithmetic.subtract(s, u, u);
+	arithmetic.multiply(u, u, uCube);
+	arithmetic.multiply(uCube, u, uCube);
+	arithmetic.subtract(v, u, difference);
+	Point point { uCube, arithmetic.getZero() };
+	arithmetic.multiply(v, v, point.z);
+	arithmetic.multiply(point.z, v, point.z);
+	//(A + 2) / 4 = (v - u)^3 (3u + v) / (16 u^3 v)
+	arithmetic.multiply(numerator, u, numerator);
+	arithmetic.add(numerator, v, numerator);
+	arithmetic.multiply(numerator, difference, numerator);
+	arithmetic.multiply(numerator, difference, numerator);
+	arithmetic.multiply(numerator, difference, numerator);
+	arithmetic.multiply(denominator, uCube, denominator);
+	arithmetic.multiply(denominator, v, denominator);
+	Words divisor = arithmetic.getGCD(denominator);
+	if(!isOne(divisor)) return isProperDivisor(divisor, arithmetic) ? divisor : Words();
+	CurveArithmetic curve(arithmetic, numerator, denominator);
+	//stage 1
+	for(unsigned long long prime : primes){
+		if(prime > bound) break;
+		unsigned long long power { prime };
+		while(power <= bound / prime) power *= prime;
+		curve.multiplyPoint(point, power, point);
+	}
+	divisor = arithmetic.getGCD(point.z);
+	if(!isOne(divisor)) return isProperDivisor(divisor, arithmetic) ? divisor : Words();
+	//stage 2: multiples[d] = 2(d + 1) * point
+	std::vector<Point> multiples(ECM_STAGE_TWO_POINTS, curve.getZero());
+	curve.doublePoint(point, multiples[0]);
+	curve.doublePoint(multiples[0], multiples[1]);
+	for(unsigned long long d = 2; d < ECM_STAGE_TWO_POINTS; ++d){
+		curve.addPoints(multiples[d - 1], multiples.front(), multiples[d - 2], multiples[d]);
+	}
+	std::vector<Words> products(ECM_STAGE_TWO_POINTS, arithmetic.getZero());
+	for(std::size_t d = 0; d < multiples.size(); ++d) arithmetic.multiply(multiples[d].x, multiples[d].z, products[d]);
+	const Point &step = multiples.back();
+	unsigned long long start { bound & 1 ? bound : bound - 1 };
+	Point current = curve.getZero(), previous = curve.getZero();
+	curve.multiplyPoint(point, start, current);
+	curve.multiplyPoint(point, start - 2 * ECM_STAGE_TWO_POINTS, previous);
+	Words
+		accumulated = arithmetic.getOne(),
+		product = arithmetic.getZero(),
+		term = arithmetic.getZero(),
+		sum = arithmetic.getZero();
+	auto prime = std::upper_bound(primes.begin(), primes.end(), start);
+	for(unsigned long long r = start; prime != primes.end(); r += 2 * ECM_STAGE_TWO_POINTS){
+		arithmetic.multiply(current.x, current.z, product);
+		//X_R Z_S - X_S Z_R vanishes modulo p if r q = +/- 2d q for point of order q modulo p
+		for(; prime != primes.end() && *prime <= r + 2 * ECM_STAGE_TWO_POINTS; ++prime){
+			std::size_t d { static_cast<std::size_t>((*prime - r) / 2 - 1) };
+			arithmetic.subtract(current.x, multiples[d].x, term);
+			arithmetic.add(current.z, multiples[d].z, sum);
+			arithmetic.multiply(term, sum, term);
+			arithmetic.subtract(term, product, term);
+			arithmetic.add(term, products[d], term);
+			arithmetic.multiply(accumulated, term, accumulated);
+		}
+		//next point replaces previous one, which is its difference with step
+		curve.addPoints(current, step, previous, previous);
+		std::swap(previous, current);
+	}
+	divisor = arithmetic.getGCD(accumulated);
+	return isProperDivisor(divisor, arithmetic) ? divisor : Words();
+}
+
+/**
+ * @brief
+ * 	Looks for divisor with elliptic curve method.
+ *
+ * @details
+ * 	Bounds grow after a number of curves suitable for factors of growing size. Curves are run in all hardware
+ * 	threads at once, and the first divisor found is returned.
+ *
+ * @param arithmetic
+ * 	Arithmetic of odd composite modulus, which is not a perfect power.
+ *
+ * @return
+ * 	Proper divisor of modulus.
+ */
+Words getDivisorByCurves(const MontgomeryArithmetic &arithmetic){
+	//stage 1 bounds and numbers of curves optimal for factors of 15, 20, 25, 30, 35 and 40 digits
+	const std::vector<std::pair<unsigned long long, unsigned long long>> levels {
+		{ 2000, 25 }, { 11000, 90 }, { 50000, 300 }, { 250000, 700 }, { 1000000, 1800 }, { 3000000, 5100 } };
+	unsigned threads { tech::getThreadCount() };
+	unsigned long long sigma { 6 };
+	for(std::size_t level = 0;; level = std::min(level + 1, levels.size() - 1)){
+		unsigned long long bound { levels[level].first };
+		std::vector<unsigned long long> primes = getPrimes(100 * bound);
+		std::atomic<bool> found { false };
+		std::atomic<unsigned long long> nextSigma { sigma };
+		unsigned long long lastSigma { sigma + levels[level].second };
+		auto work = [&](){
+			for(unsigned long long curve = nextSigma++; curve < lastSigma && !found; curve = nextSigma++){
+				Words divisor = getDivisorByCurve(arithmetic, curve, bound, primes);
+				if(!divisor.empty()){
+					found = true;
+					return divisor;
+				}
+			}
+			return Words();
+		};
+		std::vector<Words> divisors(threads);
+		tech::TaskGroup group;
+		for(unsigned i = 1; i < threads; ++i) group.fork([&, i](){ divisors[i] = work(); });
+		divisors.front() = work();
+		group.join();
+		Words divisor;
+		for(const auto &other : divisors){
+			if(divisor.empty()) divisor = other;
+		}
+		if(!divisor.empty()) return divisor;
+		sigma = lastSigma;
+	}
+}
+
+/**
+ * @brief
+ * 	Finds perfect power representation with the greatest exponent.
+ *
+ * @details
+ * 	Only prime exponents are tried, composite ones are found by recursion on the root.
+ *
+ * @param number
+ * 	Number greater than one.
+ *
+ * @param exponent
+ * 	Variable for exponent.
+ *
+ * @return
+ * 	Root r such that r^@a exponent equals @a number, with the greatest possible @a exponent.
+ */
+Pointer<Integer> getLeastRoot(Pointer<Integer> number, unsigned long long &exponent){
+	exponent = 1;
+	if(!isPerfectPower(number)) return number;
+	for(unsigned long long prime : getPrimes(number->getBitLength())){
+		Pointer<Integer> root = getIntegerRoot(number, prime);
+		if(getPower(root, prime)->compare(number) == CompareResult::Equal){
+			root = getLeastRoot(root, exponent);
+			exponent *= prime;
+			return root;
+		}
+	}
+	return number;
+}
+
+/**
+ * @brief
+ * 	Finds prime factors of odd number without small factors.
+ *
+ * @param number
+ * 	Odd number greater than one.
+ *
+ * @param factors
+ * 	Vector to which factors are appended.
+ */
+void appendPrimeFactors(Pointer<Integer> number, std::vector<Pointer<Integer>> &factors){
+	if(isProbablePrime(number)){
+		factors.push_back(number);
+		return;
+	}
+	unsigned long long exponent;
+	Pointer<Integer> root = getLeastRoot(number, exponent);
+	if(exponent > 1){
+		std::vector<Pointer<Integer>> rootFactors;
+		appendPrimeFactors(root, rootFactors);
+		for(unsigned long long i = 0; i < exponent; ++i) factors.insert(factors.end(), rootFactors.begin(), rootFactors.end());
+		return;
+	}
+	MontgomeryArithmetic arithmetic(number);
+	Words divisor;
+	for(unsigned long long increment = 1; divisor.empty() && increment <= 3; ++increment){
+		divisor = getDivisorByRho(arithmetic, increment, RHO_LIMIT);
+	}
+	if(divisor.empty()) divisor = getDivisorByCurves(arithmetic);
+	Pointer<Integer> divisorAsInteger = getInteger(divisor);
+	appendPrimeFactors(divisorAsInteger, factors);
+	appendPrimeFactors(staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(number)->getIntegerQuotient(
+			divisorAsInteger), factors);
+}
+
+}
+
+std::vector<Pointer<Integer>> getPrimeFactors(Pointer<Integer> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), std::vector<Pointer<Integer>>());
+	std::vector<Pointer<Integer>> factors;
+	Pointer<Integer> rest = staticPointerCast<Integer>(number->getAbsoluteValue());
+	if(rest->isZero()) return factors;
+	//trial division, primes are grouped in products fitting in one word
+	static const std::vector<unsigned long long> primes = getPrimes(TRIAL_DIVISION_LIMIT);
+	for(std::size_t i = 0; i < primes.size() && rest->getBitLength() > 1;){
+		std::size_t end { i };
+		unsigned long long product { 1 };
+		while(end < primes.size() && product <= std::numeric_limits<unsigned long long>::max() / primes[end]){
+			product *= primes[end++];
+		}
+		unsigned long long remainder { rest->getSmallRemainder(product) };
+		for(; i < end; ++i){
+			if(remainder % primes[i]) continue;
+			while(!rest->getSmallRemainder(primes[i])){
+				rest = rest->getSmallQuotient(primes[i]);
+				factors.push_back(Unsigned::fromUnsignedLongLong(primes[i]));
+			}
+		}
+	}
+	if(rest->getBitLength() > 1){
+		std::vector<Pointer<Integer>> large;
+		appendPrimeFactors(rest, large);
+		std::sort(large.begin(), large.end(), [](const Pointer<Integer> &lhs, const Pointer<Integer> &rhs){
+			return lhs->compare(rhs) == CompareResult::ThisLesser;
+		});
+		factors.insert(factors.end(), large.begin(), large.end());
+	}
+	return factors;
+}
+
+}  // namespace numb
+}  // namespace coma
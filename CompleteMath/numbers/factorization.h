@@ -0,0 +1,40 @@
+/*
+ * factorization.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_FACTORIZATION_H_
+#define NUMBERS_FACTORIZATION_H_
+
+#include "Integer.h"
+
+#include <vector>
+
+namespace coma {
+namespace numb {
+
+/**
+ * @brief
+ * 	Finds prime factorization of given Integer.
+ *
+ * @details
+ * 	Small factors are removed by trial division by sieved primes. Remaining composite parts are split with
+ * 	Pollard-Brent rho method, and if it does not succeed quickly, with elliptic curve method (stage 1 and 2 on
+ * 	Montgomery curves) with growing bounds. Curves are tried in parallel in several threads. All modular
+ * 	arithmetic of both methods is done in Montgomery form on 64 bit words, without creating Integers.
+ *
+ * @param number
+ * 	Number to factor.
+ *
+ * @return
+ * 	Prime factors of |@a number| in non-decreasing order, repeated according to their multiplicity. For zero
+ * 	and units empty vector is returned.
+ */
+std::vector<Pointer<Integer>> getPrimeFactors(Pointer<Integer> number);
+
+}  // namespace numb
+}  // namespace coma
+
+#endif /* NUMBERS_FACTORIZATION_H_ */
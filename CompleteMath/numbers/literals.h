@@ -0,0 +1,239 @@
+/*
+ * literals.h
+ *
+ *  Created on: 19 paz 2026
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_LITERALS_H_
+#define NUMBERS_LITERALS_H_
+
+#include "FixedUnsigned.h"
+#include "Unsigned.h"
+
+#include <cstddef>
+
+namespace coma {
+namespace numb {
+namespace literals {
+
+/**
+ * @brief
+ * 	Parser of integer literals at compile time.
+ *
+ * @details
+ * 	Literal may be decimal, hexadecimal (0x), binary (0b) or octal (leading zero) and may contain digit
+ * 	separators.
+ *
+ * @tparam Chars
+ * 	Characters of literal, as passed to literal operator template.
+ */
+template<char... Chars>
+class LiteralParser {
+public:
+	/**
+	 * @brief
+	 * 	Checks if characters form integer literal.
+	 *
+	 * @return
+	 * 	True if literal has at least one digit and all digits are valid in its base, else returns false.
+	 */
+	static constexpr bool isValid() noexcept;
+
+	/**
+	 * @brief
+	 * 	Finds number of bits of value.
+	 *
+	 * @return
+	 * 	Bit length of value rounded up to multiple of 64, at least 64.
+	 */
+	static constexpr std::size_t getBits() noexcept;
+
+	/**
+	 * @brief
+	 * 	Parses literal.
+	 *
+	 * @tparam Bits
+	 * 	Number of bits of value. Bits above it are dropped.
+	 *
+	 * @return
+	 * 	Value of literal.
+	 */
+	template<std::size_t Bits>
+	static constexpr FixedUnsigned<Bits> getValue() noexcept;
+
+private:
+	/**
+	 * @brief
+	 * 	Finds base of literal from its prefix.
+	 *
+	 * @return
+	 * 	16, 2, 8 or 10.
+	 */
+	static constexpr unsigned getBase() noexcept;
+
+	/**
+	 * @brief
+	 * 	Finds length of prefix of literal.
+	 *
+	 * @return
+	 * 	2 for hexadecimal and binary literals, else 0.
+	 */
+	static constexpr std::size_t getPrefixLength() noexcept;
+
+	/**
+	 * @brief
+	 * 	Finds value of digit.
+	 *
+	 * @param digit
+	 * 	Character of digit.
+	 *
+	 * @return
+	 * 	Value of @a digit, or 16 if it is not a digit.
+	 */
+	static constexpr unsigned getDigit(char digit) noexcept;
+
+	/**
+	 * @brief
+	 * 	Finds number of bits of every number with as many digits as literal.
+	 *
+	 * @return
+	 * 	Number of digits multiplied by bits per digit (rounded up log2(10) for decimal literals), rounded up to
+	 * 	multiple of 64.
+	 */
+	static constexpr std::size_t getMaximalBits() noexcept;
+};
+
+/**
+ * @brief
+ * 	Value of integer literal, constant initialized, so no parsing is done at run time.
+ *
+ * @tparam Chars
+ * 	Characters of literal, as passed to literal operator template.
+ */
+template<char... Chars>
+class Literal {
+public:
+	/**
+	 * @brief
+	 * 	Number of bits of value.
+	 */
+	static constexpr std::size_t BITS { LiteralParser<Chars...>::getBits() };
+
+	/**
+	 * @brief
+	 * 	Value of literal.
+	 */
+	static constexpr FixedUnsigned<BITS> VALUE { LiteralParser<Chars...>::template getValue<BITS>() };
+};
+
+template<char... Chars>
+constexpr std::size_t Literal<Chars...>::BITS;
+
+template<char... Chars>
+constexpr FixedUnsigned<Literal<Chars...>::BITS> Literal<Chars...>::VALUE;
+
+template<char... Chars>
+constexpr bool LiteralParser<Chars...>::isValid() noexcept{
+	const char chars[] { Chars... };
+	std::size_t digits { 0 };
+	for(std::size_t i = getPrefixLength(); i < sizeof...(Chars); ++i){
+		if(chars[i] == '\'') continue;
+		if(getDigit(chars[i]) >= getBase()) return false;
+		++digits;
+	}
+	return digits > 0;
+}
+
+template<char... Chars>
+constexpr std::size_t LiteralParser<Chars...>::getBits() noexcept{
+	std::size_t bits { getValue<getMaximalBits()>().getBitLength() };
+	return bits ? (bits + 63) / 64 * 64 : 64;
+}
+
+template<char... Chars>
+constexpr std::size_t LiteralParser<Chars...>::getMaximalBits() noexcept{
+	const char chars[] { Chars... };
+	std::size_t digits { 0 };
+	for(std::size_t i = getPrefixLength(); i < sizeof...(Chars); ++i){
+		if(chars[i] != '\'') ++digits;
+	}
+	//3.322 bits per decimal digit exceeds log2(10)
+	std::size_t bits { getBase() == 10 ? (digits * 3322 + 999) / 1000 : digits * (getBase() == 16 ? 4 : getBase() == 8 ? 3 : 1) };
+	return bits ? (bits + 63) / 64 * 64 : 64;
+}
+
+template<char... Chars>
+template<std::size_t Bits>
+constexpr FixedUnsigned<Bits> LiteralParser<Chars...>::getValue() noexcept{
+	const char chars[] { Chars... };
+	FixedUnsigned<Bits> value, base { getBase() };
+	for(std::size_t i = getPrefixLength(); i < sizeof...(Chars); ++i){
+		if(chars[i] == '\'' || getDigit(chars[i]) >= getBase()) continue;
+		value = value * base + FixedUnsigned<Bits>(getDigit(chars[i]));
+	}
+	return value;
+}
+
+template<char... Chars>
+constexpr unsigned LiteralParser<Chars...>::getBase() noexcept{
+	const char chars[] { Chars... };
+	if(sizeof...(Chars) < 2 || chars[0] != '0') return 10;
+	if(chars[1] == 'x' || chars[1] == 'X') return 16;
+	if(chars[1] == 'b' || chars[1] == 'B') return 2;
+	return 8;
+}
+
+template<char... Chars>
+constexpr std::size_t LiteralParser<Chars...>::getPrefixLength() noexcept{
+	return getBase() == 16 || getBase() == 2 ? 2 : 0;
+}
+
+template<char... Chars>
+constexpr unsigned LiteralParser<Chars...>::getDigit(char digit) noexcept{
+	if(digit >= '0' && digit <= '9') return digit - '0';
+	if(digit >= 'a' && digit <= 'f') return digit - 'a' + 10;
+	if(digit >= 'A' && digit <= 'F') return digit - 'A' + 10;
+	return 16;
+}
+
+/**
+ * @brief
+ * 	Creates fixed width number from integer literal at compile time.
+ *
+ * @details
+ * 	Number has the smallest multiple of 64 bits which fits value of literal, for example
+ * 	0xFFFFFFFFFFFFFFFF0000000000000000_cu is FixedUnsigned<128>.
+ *
+ * @return
+ * 	Value of literal.
+ */
+template<char... Chars>
+constexpr FixedUnsigned<Literal<Chars...>::BITS> operator""_cu() noexcept{
+	static_assert(LiteralParser<Chars...>::isValid(), "Invalid integer literal");
+	return Literal<Chars...>::VALUE;
+}
+
+/**
+ * @brief
+ * 	Creates Unsigned from integer literal parsed at compile time.
+ *
+ * @details
+ * 	Unsigned is created from constant words of literal once, at first use, and shared by later uses of the
+ * 	same literal.
+ *
+ * @return
+ * 	Value of literal.
+ */
+template<char... Chars>
+Pointer<Unsigned> operator""_du(){
+	static_assert(LiteralParser<Chars...>::isValid(), "Invalid integer literal");
+	static const Pointer<Unsigned> value { Literal<Chars...>::VALUE.getAsUnsigned() };
+	return value;
+}
+
+} /* namespace literals */
+} /* namespace numb */
+} /* namespace coma */
+
+#endif /* NUMBERS_LITERALS_H_ */
@@ -1,35 +1,916 @@
-/*
- * math.cpp
- *
- *  Created on: 29 lip 2015
- *      Author: Bartosz Miera
- */
-
-#include "math.h"
-
-namespace coma {
-namespace numb {
-
-Pointer<Integer> getGCD(Pointer<Integer> numberOne, Pointer<Integer> numberTwo){
-	Pointer<Integer>
-		one = staticPointerCast<Integer>(numberOne->getAbsoluteValue()),
-		two = staticPointerCast<Integer>(numberTwo->getAbsoluteValue());
-	while(!one->isZero()){
-		Pointer<Integer> tmp = one;
-		one = staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(two)->getRemainder(tmp);
-		two = tmp;
-	}
-	return two;
-}
-
-Pointer<Integer> getLCM(Pointer<Integer> numberOne, Pointer<Integer> numberTwo){
-	Pointer<Integer> tmp = getGCD(numberOne, numberTwo);
-	tmp = staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(
-			numberOne)->getIntegerQuotient(tmp);
-	tmp = staticPointerCast<Integer>(tmp->getProduct(numberTwo));
-	return tmp;
-}
-
-}  // namespace numb
-}  // namespace coma
-
+/*
+ * math.cpp
+ *
+ *  Created on: 29 lip 2015
+ *      Author: Bartosz Miera
+ */
+
+#include "math.h"
+#include "Unsigned.h"
+#include "BarrettReducer.h"
+
+#include "../Technical/Concurrency.h"
+#include "../Technical/TaskGroup.h"
+#include "../Utility/ArrayArithmetic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace coma {
+namespace numb {
+
+namespace{
+
+/**
+ * @brief
+ * 	Minimal number of bits of factors in product tree's subtree for which its halves are evaluated in separate
+ * 	threads.
+ */
+const unsigned long long PARALLEL_THRESHOLD { 1ull << 16 };
+
+/**
+ * @brief
+ * 	Multiplies range of factors in balanced product tree.
+ *
+ * @details
+ * 	Range is split where half of its bits is reached, so subtrees have similar sizes even for factors of
+ * 	different lengths.
+ *
+ * @param numbers
+ * 	Factors.
+ *
+ * @param bitsBefore
+ * 	Prefix sums of bit lengths of @a numbers, with the leading zero.
+ *
+ * @param begin
+ * 	Index of the first factor.
+ *
+ * @param end
+ * 	Index after the last factor, greater than @a begin.
+ *
+ * @param depth
+ * 	Number of levels of the tree on which halves are still evaluated in parallel.
+ *
+ * @return
+ * 	Product of factors from [@a begin, @a end).
+ */
+Pointer<Integer> getProductOfRange(const std::vector<Pointer<Integer>> &numbers,
+		const std::vector<unsigned long long> &bitsBefore, std::size_t begin, std::size_t end, unsigned depth){
+	if(end - begin == 1) return numbers[begin];
+	unsigned long long half { bitsBefore[begin] + (bitsBefore[end] - bitsBefore[begin]) / 2 };
+	std::size_t middle = std::upper_bound(bitsBefore.begin() + begin, bitsBefore.begin() + end, half) - bitsBefore.begin();
+	middle = std::min(std::max(middle, begin + 1), end - 1);
+	Pointer<Integer> left, right;
+	if(depth && bitsBefore[end] - bitsBefore[begin] >= PARALLEL_THRESHOLD){
+		tech::TaskGroup group;
+		group.fork([&](){ left = getProductOfRange(numbers, bitsBefore, begin, middle, depth - 1); });
+		right = getProductOfRange(numbers, bitsBefore, middle, end, depth - 1);
+		group.join();
+	}else{
+		left = getProductOfRange(numbers, bitsBefore, begin, middle, 0);
+		right = getProductOfRange(numbers, bitsBefore, middle, end, 0);
+	}
+	return staticPointerCast<Integer>(left->getProduct(right));
+}
+
+/**
+ * @brief
+ * 	Checks if given built-in number raised to given power does not exceed limit.
+ *
+ * @param value
+ * 	Base.
+ *
+ * @param degree
+ * 	Exponent.
+ *
+ * @param limit
+ * 	Limit.
+ *
+ * @return
+ * 	True if @a value^@a degree <= @a limit. Else returns false.
+ */
+bool isPowerNotGreater(unsigned long long value, unsigned long long degree, unsigned long long limit){
+	unsigned long long power { 1 };
+	for(unsigned long long i = 0; i < degree; ++i){
+		if(value && power > limit / value) return false;
+		power *= value;
+	}
+	return true;
+}
+
+/**
+ * @brief
+ * 	Finds integer root of built-in number.
+ *
+ * @details
+ * 	Floating point estimate is corrected in both directions, so result is exact.
+ *
+ * @param number
+ * 	Number to root.
+ *
+ * @param degree
+ * 	Positive degree of root.
+ *
+ * @return
+ * 	floor(@a number^(1/@a degree)).
+ */
+unsigned long long getSmallRoot(unsigned long long number, unsigned long long degree){
+	if(number < 2 || degree == 1) return number;
+	if(degree >= 64) return 1;
+	unsigned long long root { static_cast<unsigned long long>(std::pow(static_cast<double>(number), 1.0 / degree)) };
+	while(root > 1 && !isPowerNotGreater(root, degree, number)) --root;
+	while(isPowerNotGreater(root + 1, degree, number)) ++root;
+	return root;
+}
+
+/**
+ * @brief
+ * 	Finds integer root of non-negative Integer.
+ *
+ * @param number
+ * 	Non-negative number.
+ *
+ * @param degree
+ * 	Positive degree of root.
+ *
+ * @return
+ * 	floor(@a number^(1/@a degree)).
+ */
+Pointer<Integer> getRootOfMagnitude(Pointer<Integer> number, unsigned long long degree){
+	unsigned long long bits { number->getBitLength() };
+	if(bits <= 64){
+		return Unsigned::fromUnsignedLongLong(getSmallRoot(static_cast<unsigned long long>(number->getAsLongLong()), degree));
+	}
+	if(degree >= bits) return Number::ONE();
+	//root of top bits of number gives upper estimate of half of root's bits
+	unsigned long long shift { bits / degree / 2 };
+	Pointer<Integer> root;
+	if(shift){
+		root = getRootOfMagnitude(number->getShiftedRight(shift * degree), degree);
+		root = staticPointerCast<Integer>(root->getSum(Number::ONE()))->getShiftedLeft(shift);
+	}else{
+		root = Number::ONE()->getShiftedLeft((bits + degree - 1) / degree);
+	}
+	//Newton iteration decreases monotonically from estimate above the root
+	Pointer<Integer> degreeLessOne = Unsigned::fromUnsignedLongLong(degree - 1);
+	while(true){
+		Pointer<Integer> next = staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(number)->getIntegerQuotient(
+				degree == 2 ? root : getPower(root, degree - 1));
+		next = staticPointerCast<Integer>(next->getSum(degree == 2 ? root : root->getProduct(degreeLessOne)));
+		next = degree == 2 ? next->getShiftedRight(1) : next->getSmallQuotient(degree);
+		if(next->compare(root) != CompareResult::ThisLesser) return root;
+		root = next;
+	}
+}
+
+/**
+ * @brief
+ * 	Builds table of quadratic residues.
+ *
+ * @param modulus
+ * 	Modulus.
+ *
+ * @return
+ * 	Table in which element of index i is true if i is a square modulo @a modulus.
+ */
+std::vector<bool> getQuadraticResidues(unsigned long long modulus){
+	std::vector<bool> residues(modulus, false);
+	for(unsigned long long i = 0; i < modulus; ++i) residues[i * i % modulus] = true;
+	return residues;
+}
+
+/**
+ * @brief
+ * 	Greatest argument of getBinomial() for which primes are sieved.
+ */
+const unsigned long long SIEVE_LIMIT { 1ull << 28 };
+
+/**
+ * @brief
+ * 	Computes exponent of prime in factorial with Legendre's formula.
+ *
+ * @param number
+ * 	Number which factorial is considered.
+ *
+ * @param prime
+ * 	Prime.
+ *
+ * @return
+ * 	Exponent of @a prime in @a number!.
+ */
+unsigned long long getFactorialExponent(unsigned long long number, unsigned long long prime){
+	unsigned long long exponent { 0 };
+	while(number){
+		number /= prime;
+		exponent += number;
+	}
+	return exponent;
+}
+
+/**
+ * @brief
+ * 	Multiplies built-in factors in balanced product tree.
+ *
+ * @details
+ * 	Consecutive factors are first packed into built-in words as long as their product fits, so leaves of the
+ * 	tree are full 64 bit numbers.
+ *
+ * @param factors
+ * 	Factors to multiply.
+ *
+ * @return
+ * 	Product of all @a factors. For empty sequence one is returned.
+ */
+Pointer<Integer> getProductOfFactors(const std::vector<unsigned long long> &factors){
+	std::vector<Pointer<Integer>> level;
+	unsigned long long packed { 1 };
+	for(unsigned long long factor : factors){
+		if(factor && packed > std::numeric_limits<unsigned long long>::max() / factor){
+			level.push_back(Unsigned::fromUnsignedLongLong(packed));
+			packed = 1;
+		}
+		packed *= factor;
+	}
+	level.push_back(Unsigned::fromUnsignedLongLong(packed));
+	return getProductOf(level, true);
+}
+
+/**
+ * @brief
+ * 	Multiplies powers of primes.
+ *
+ * @details
+ * 	Result is built from the most significant bit of exponents: on every step current result is squared and
+ * 	multiplied by product of primes which exponents have given bit set. Thanks to that large powers of small
+ * 	primes cost only a few squarings.
+ *
+ * @param powers
+ * 	Pairs of prime and its exponent.
+ *
+ * @return
+ * 	Product of @a powers.
+ */
+Pointer<Integer> getProductOfPowers(const std::vector<std::pair<unsigned long long, unsigned long long>> &powers){
+	unsigned long long maximalExponent { 0 };
+	for(const auto &power : powers) maximalExponent = std::max(maximalExponent, power.second);
+	unsigned bit { 0 };
+	while(bit < 64 && (maximalExponent >> bit)) ++bit;
+	Pointer<Integer> result = Number::ONE();
+	while(bit-- > 0){
+		result = staticPointerCast<Integer>(result->getProduct(result));
+		std::vector<unsigned long long> factors;
+		for(const auto &power : powers){
+			if((power.second >> bit) & 1) factors.push_back(power.first);
+		}
+		result = staticPointerCast<Integer>(result->getProduct(getProductOfFactors(factors)));
+	}
+	return result;
+}
+
+/**
+ * @brief
+ * 	Computes odd part of factorial with prime swing recursion.
+ *
+ * @param number
+ * 	Number which factorial is computed.
+ *
+ * @param primes
+ * 	Odd primes not greater than @a number in increasing order. May contain greater primes too.
+ *
+ * @return
+ * 	@a number! with all factors of two removed.
+ */
+Pointer<Integer> getOddFactorial(unsigned long long number, const std::vector<unsigned long long> &primes){
+	if(number < 3) return Number::ONE();
+	Pointer<Integer> result = getOddFactorial(number / 2, primes);
+	result = staticPointerCast<Integer>(result->getProduct(result));
+	//exponent of prime p in swing(n) is number of odd values among floor(n / p^i)
+	std::vector<unsigned long long> factors;
+	for(unsigned long long prime : primes){
+		if(prime > number) break;
+		for(unsigned long long quotient = number / prime; quotient; quotient /= prime){
+			if(quotient & 1) factors.push_back(prime);
+		}
+	}
+	return staticPointerCast<Integer>(result->getProduct(getProductOfFactors(factors)));
+}
+
+/**
+ * @brief
+ * 	Bound of primes used for trial division before probable prime tests.
+ */
+const unsigned long long SMALL_PRIME_LIMIT { 1ull << 12 };
+
+/**
+ * @brief
+ * 	Gets primes used for trial division.
+ *
+ * @return
+ * 	Increasing sequence of primes lesser than SMALL_PRIME_LIMIT.
+ */
+const std::vector<unsigned long long> &getSmallPrimes(){
+	static const std::vector<unsigned long long> primes = getPrimes(SMALL_PRIME_LIMIT);
+	return primes;
+}
+
+/**
+ * @brief
+ * 	Finds remainders of number modulo all small primes.
+ *
+ * @details
+ * 	Primes are grouped in products fitting in one word, so one pass over the number serves several primes
+ * 	and the rest is done in built-in arithmetic.
+ *
+ * @param number
+ * 	Number to divide.
+ *
+ * @return
+ * 	Remainders of |@a number| modulo consecutive primes from getSmallPrimes().
+ */
+std::vector<unsigned long long> getSmallPrimeRemainders(Pointer<Integer> number){
+	const std::vector<unsigned long long> &primes = getSmallPrimes();
+	std::vector<unsigned long long> remainders;
+	for(std::size_t i = 0; i < primes.size();){
+		std::size_t end { i };
+		unsigned long long product { 1 };
+		while(end < primes.size() && product <= std::numeric_limits<unsigned long long>::max() / primes[end]){
+			product *= primes[end++];
+		}
+		unsigned long long remainder { number->getSmallRemainder(product) };
+		for(; i < end; ++i) remainders.push_back(remainder % primes[i]);
+	}
+	return remainders;
+}
+
+/**
+ * @brief
+ * 	Creates Integer from built-in signed number.
+ *
+ * @param value
+ * 	Value of number.
+ *
+ * @return
+ * 	Integer equal to @a value.
+ */
+Pointer<Integer> fromLongLong(long long value){
+	Pointer<Integer> magnitude = Unsigned::fromUnsignedLongLong(
+			value < 0 ? 0ull - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value));
+	return value < 0 ? staticPointerCast<Integer>(magnitude->getNegation()) : magnitude;
+}
+
+/**
+ * @brief
+ * 	Splits non-negative Integer into 64 bit words.
+ *
+ * @param number
+ * 	Non-negative number.
+ *
+ * @return
+ * 	Words of @a number starting from the least significant one.
+ */
+std::vector<unsigned long long> getWords(Pointer<Integer> number){
+	std::vector<unsigned long long> words;
+	for(unsigned long long i = 0; i < number->getBitLength(); i += 64){
+		words.push_back(static_cast<unsigned long long>(number->getShiftedRight(i)->getAsLongLong()));
+	}
+	return words;
+}
+
+/**
+ * @brief
+ * 	Checks bit of number split into words.
+ *
+ * @param words
+ * 	Words of number starting from the least significant one.
+ *
+ * @param bit
+ * 	Position of bit.
+ *
+ * @return
+ * 	True if bit at position @a bit is set. Else returns false.
+ */
+bool isBitSet(const std::vector<unsigned long long> &words, unsigned long long bit){
+	return bit / 64 < words.size() && ((words[bit / 64] >> (bit % 64)) & 1);
+}
+
+/**
+ * @brief
+ * 	Multiplies two numbers modulo modulus of reducer.
+ *
+ * @param lhs
+ * 	First factor.
+ *
+ * @param rhs
+ * 	Second factor, if it is the same object as @a lhs, squaring is used.
+ *
+ * @param reducer
+ * 	Reducer of modulus.
+ *
+ * @return
+ * 	@a lhs * @a rhs mod modulus.
+ */
+Pointer<Integer> multiplyModulo(Pointer<Integer> lhs, Pointer<Integer> rhs, const BarrettReducer &reducer){
+	return reducer.getRemainder(staticPointerCast<Integer>(lhs->getProduct(rhs)));
+}
+
+/**
+ * @brief
+ * 	Raises number to given power modulo modulus of reducer.
+ *
+ * @details
+ * 	Uses the same sliding window as getPower(), with every product reduced right away.
+ *
+ * @param base
+ * 	Number to raise, already reduced.
+ *
+ * @param exponent
+ * 	Words of non-negative exponent.
+ *
+ * @param reducer
+ * 	Reducer of modulus.
+ *
+ * @return
+ * 	@a base^@a exponent mod modulus.
+ */
+Pointer<Integer> getModularPower(Pointer<Integer> base, const std::vector<unsigned long long> &exponent,
+		const BarrettReducer &reducer){
+	long long bits { static_cast<long long>(64 * exponent.size()) };
+	while(bits > 0 && !isBitSet(exponent, bits - 1)) --bits;
+	if(!bits) return reducer.getRemainder(Number::ONE());
+	unsigned window { bits > 512 ? 5u : bits > 64 ? 4u : bits > 6 ? 3u : bits > 2 ? 2u : 1u };
+	//odd powers: base^1, base^3, ..., base^(2^window - 1)
+	std::vector<Pointer<Integer>> oddPowers { base };
+	if(window > 1){
+		Pointer<Integer> square = multiplyModulo(base, base, reducer);
+		for(unsigned i = 1; i < (1u << (window - 1)); ++i){
+			oddPowers.push_back(multiplyModulo(oddPowers.back(), square, reducer));
+		}
+	}
+	Pointer<Integer> result{};
+	for(long long i = bits - 1; i >= 0;){
+		if(!isBitSet(exponent, i)){
+			result = multiplyModulo(result, result, reducer);
+			--i;
+			continue;
+		}
+		long long j { std::max(i - static_cast<long long>(window) + 1, 0ll) };
+		while(!isBitSet(exponent, j)) ++j;
+		unsigned value { 0 };
+		for(long long k = i; k >= j; --k) value = (value << 1) | (isBitSet(exponent, k) ? 1 : 0);
+		if(result){
+			for(long long k = j; k <= i; ++k) result = multiplyModulo(result, result, reducer);
+			result = multiplyModulo(result, oddPowers[value >> 1], reducer);
+		}else{
+			result = oddPowers[value >> 1];
+		}
+		i = j - 1;
+	}
+	return result;
+}
+
+/**
+ * @brief
+ * 	Computes Jacobi symbol of built-in numbers.
+ *
+ * @param numerator
+ * 	Upper argument.
+ *
+ * @param denominator
+ * 	Odd positive lower argument.
+ *
+ * @return
+ * 	(@a numerator / @a denominator), one of -1, 0 and 1.
+ */
+int getJacobiSymbol(unsigned long long numerator, unsigned long long denominator){
+	int result { 1 };
+	numerator %= denominator;
+	while(numerator){
+		while(!(numerator & 1)){
+			numerator >>= 1;
+			if((denominator & 7) == 3 || (denominator & 7) == 5) result = -result;
+		}
+		std::swap(numerator, denominator);
+		if((numerator & 3) == 3 && (denominator & 3) == 3) result = -result;
+		numerator %= denominator;
+	}
+	return denominator == 1 ? result : 0;
+}
+
+/**
+ * @brief
+ * 	Computes Jacobi symbol of small odd number over Integer.
+ *
+ * @details
+ * 	Quadratic reciprocity turns it into symbol of built-in numbers.
+ *
+ * @param numerator
+ * 	Odd upper argument.
+ *
+ * @param denominator
+ * 	Odd positive lower argument.
+ *
+ * @return
+ * 	(@a numerator / @a denominator), one of -1, 0 and 1.
+ */
+int getJacobiSymbol(long long numerator, Pointer<Integer> denominator){
+	unsigned long long magnitude { numerator < 0 ? 0ull - static_cast<unsigned long long>(numerator) :
+			static_cast<unsigned long long>(numerator) };
+	bool isDenominatorOneModFour { (denominator->getAsLongLong() & 3) == 1 };
+	int result { getJacobiSymbol(denominator->getSmallRemainder(magnitude), magnitude) };
+	if((magnitude & 3) == 3 && !isDenominatorOneModFour) result = -result;
+	if(numerator < 0 && !isDenominatorOneModFour) result = -result;
+	return result;
+}
+
+/**
+ * @brief
+ * 	Performs Miller-Rabin test with given base.
+ *
+ * @param base
+ * 	Base of test, in range [2, @a number - 2].
+ *
+ * @param number
+ * 	Odd number greater than 3.
+ *
+ * @param reducer
+ * 	Reducer of @a number.
+ *
+ * @return
+ * 	True if @a number is strong probable prime to @a base. Else returns false.
+ */
+bool isStrongProbablePrime(Pointer<Integer> base, Pointer<Integer> number, const BarrettReducer &reducer){
+	Pointer<Integer> numberLessOne = staticPointerCast<Integer>(number->getDifference(Number::ONE()));
+	unsigned long long twos { numberLessOne->getLowestSetBit() };
+	Pointer<Integer> power = getModularPower(base, getWords(numberLessOne->getShiftedRight(twos)), reducer);
+	if(power->compare(Number::ONE()) == CompareResult::Equal) return true;
+	for(unsigned long long i = 0; i < twos; ++i){
+		if(power->compare(numberLessOne) == CompareResult::Equal) return true;
+		power = multiplyModulo(power, power, reducer);
+	}
+	return false;
+}
+
+/**
+ * @brief
+ * 	Performs strong Lucas probable prime test with parameters chosen by Selfridge's method.
+ *
+ * @param number
+ * 	Odd number greater than 3, which is not a perfect square.
+ *
+ * @param reducer
+ * 	Reducer of @a number.
+ *
+ * @return
+ * 	True if @a number is strong Lucas probable prime. Else returns false.
+ */
+bool isStrongLucasProbablePrime(Pointer<Integer> number, const BarrettReducer &reducer){
+	//first of 5, -7, 9, -11, ... with Jacobi symbol -1, its absolute value divides number for symbol 0
+	long long discriminant { 5 };
+	while(true){
+		int symbol { getJacobiSymbol(discriminant, number) };
+		if(symbol == -1) break;
+		if(!symbol) return false;
+		discriminant = discriminant > 0 ? -discriminant - 2 : -discriminant + 2;
+	}
+	Pointer<Integer>
+		q = reducer.getRemainder(fromLongLong((1 - discriminant) / 4)),
+		d = reducer.getRemainder(fromLongLong(discriminant)),
+		numberPlusOne = staticPointerCast<Integer>(number->getSum(Number::ONE()));
+	auto half = [&number](Pointer<Integer> value){
+		if(value->getAsLongLong() & 1) value = staticPointerCast<Integer>(value->getSum(number));
+		return value->getShiftedRight(1);
+	};
+	unsigned long long twos { numberPlusOne->getLowestSetBit() };
+	Pointer<Integer> oddPart = numberPlusOne->getShiftedRight(twos);
+	std::vector<unsigned long long> words = getWords(oddPart);
+	//U(k), V(k) and Q^k for P = 1, starting from k = 1
+	Pointer<Integer>
+		u = Number::ONE(),
+		v = Number::ONE(),
+		qPower = q;
+	for(unsigned long long bit = oddPart->getBitLength() - 1; bit-- > 0;){
+		u = multiplyModulo(u, v, reducer);
+		v = reducer.getRemainder(staticPointerCast<Integer>(
+				multiplyModulo(v, v, reducer)->getDifference(qPower->getShiftedLeft(1))));
+		qPower = multiplyModulo(qPower, qPower, reducer);
+		if(isBitSet(words, bit)){
+			Pointer<Integer> nextU = half(staticPointerCast<Integer>(u->getSum(v)));
+			v = reducer.getRemainder(half(staticPointerCast<Integer>(multiplyModulo(d, u, reducer)->getSum(v))));
+			u = reducer.getRemainder(nextU);
+			qPower = multiplyModulo(qPower, q, reducer);
+		}
+	}
+	if(u->isZero() || v->isZero()) return true;
+	for(unsigned long long i = 1; i < twos; ++i){
+		v = reducer.getRemainder(staticPointerCast<Integer>(
+				multiplyModulo(v, v, reducer)->getDifference(qPower->getShiftedLeft(1))));
+		if(v->isZero()) return true;
+		qPower = multiplyModulo(qPower, qPower, reducer);
+	}
+	return false;
+}
+
+/**
+ * @brief
+ * 	Performs probable prime tests on number without small prime factors.
+ *
+ * @param number
+ * 	Odd number greater than SMALL_PRIME_LIMIT^2 or without small prime factors.
+ *
+ * @param rounds
+ * 	Number of additional Miller-Rabin tests with random bases.
+ *
+ * @return
+ * 	True if @a number passed all tests. Else returns false.
+ */
+bool passesProbablePrimeTests(Pointer<Integer> number, unsigned rounds){
+	BarrettReducer reducer(number);
+	if(!isStrongProbablePrime(Unsigned::fromUnsignedLongLong(2), number, reducer)) return false;
+	if(isPerfectSquare(number) || !isStrongLucasProbablePrime(number, reducer)) return false;
+	if(!rounds) return true;
+	thread_local std::mt19937_64 generator { std::random_device()() };
+	//bases are drawn from [2, min(number - 2, 2^62)]
+	unsigned long long range { number->getBitLength() > 62 ? 1ull << 62 :
+			static_cast<unsigned long long>(number->getAsLongLong()) - 3 };
+	for(unsigned i = 0; i < rounds; ++i){
+		Pointer<Integer> base = Unsigned::fromUnsignedLongLong(2 + generator() % range);
+		if(!isStrongProbablePrime(base, number, reducer)) return false;
+	}
+	return true;
+}
+
+}
+
+Pointer<Integer> getGCD(Pointer<Integer> numberOne, Pointer<Integer> numberTwo){
+	Pointer<Integer>
+		one = staticPointerCast<Integer>(numberOne->getAbsoluteValue()),
+		two = staticPointerCast<Integer>(numberTwo->getAbsoluteValue());
+	while(!one->isZero()){
+		Pointer<Integer> tmp = one;
+		one = staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(two)->getRemainder(tmp);
+		two = tmp;
+	}
+	return two;
+}
+
+Pointer<Integer> getLCM(Pointer<Integer> numberOne, Pointer<Integer> numberTwo){
+	Pointer<Integer> tmp = getGCD(numberOne, numberTwo);
+	tmp = staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(
+			numberOne)->getIntegerQuotient(tmp);
+	tmp = staticPointerCast<Integer>(tmp->getProduct(numberTwo));
+	return tmp;
+}
+
+Pointer<Integer> getPower(Pointer<Integer> base, unsigned long long exponent){
+	if(!base) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(!exponent) return Number::ONE();
+	if(base->isZero()) return base;
+	if(base->isPowerOfTwo()){
+		Pointer<Integer> result = Number::ONE()->getShiftedLeft(base->getLowestSetBit() * exponent);
+		if(base->isNegative() && (exponent & 1)) return staticPointerCast<Integer>(result->getNegation());
+		return result;
+	}
+	unsigned bits { 0 };
+	while(bits < 64 && (exponent >> bits)) ++bits;
+	unsigned window { bits > 24 ? 4u : bits > 6 ? 3u : bits > 2 ? 2u : 1u };
+	//odd powers: base^1, base^3, ..., base^(2^window - 1)
+	std::vector<Pointer<Integer>> oddPowers { base };
+	if(window > 1){
+		Pointer<Integer> square = staticPointerCast<Integer>(base->getProduct(base));
+		for(unsigned i = 1; i < (1u << (window - 1)); ++i){
+			oddPowers.push_back(staticPointerCast<Integer>(oddPowers.back()->getProduct(square)));
+		}
+	}
+	Pointer<Integer> result{};
+	for(int i = bits - 1; i >= 0;){
+		if(!((exponent >> i) & 1)){
+			result = staticPointerCast<Integer>(result->getProduct(result));
+			--i;
+			continue;
+		}
+		int j { std::max(i - static_cast<int>(window) + 1, 0) };
+		while(!((exponent >> j) & 1)) ++j;
+		unsigned long long value { (exponent >> j) & ((1ull << (i - j + 1)) - 1) };
+		if(result){
+			for(int k = j; k <= i; ++k) result = staticPointerCast<Integer>(result->getProduct(result));
+			result = staticPointerCast<Integer>(result->getProduct(oddPowers[value >> 1]));
+		}else{
+			result = oddPowers[value >> 1];
+		}
+		i = j - 1;
+	}
+	return result;
+}
+
+Pointer<Integer> getProductOf(const std::vector<Pointer<Integer>> &numbers, bool parallel){
+	if(numbers.empty()) return Number::ONE();
+	std::vector<unsigned long long> bitsBefore { 0 };
+	for(const auto &number : numbers){
+		if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+		if(number->isZero()) return Number::ZERO();
+		bitsBefore.push_back(bitsBefore.back() + number->getBitLength());
+	}
+	return getProductOfRange(numbers, bitsBefore, 0, numbers.size(), parallel ? tech::getParallelDepth(2) : 0);
+}
+
+Pointer<Integer> getSumOf(const std::vector<Pointer<Integer>> &numbers){
+	using namespace util;
+	unsigned long long length { 0 };
+	for(const auto &number : numbers){
+		if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+		length = std::max<unsigned long long>(length, number->getArray().length());
+	}
+	//eight bytes more for carries of up to 2^64 summands, absolute values of positive and negative ones are summed apart
+	tech::RuntimeArray<unsigned char> sums[2] { tech::RuntimeArray<unsigned char>(length + 8),
+		tech::RuntimeArray<unsigned char>(length + 8) };
+	for(const auto &number : numbers){
+		const tech::RuntimeArray<unsigned char> &array = number->getArray();
+		tech::RuntimeArray<unsigned char> &sum = sums[number->isNegative() ? 1 : 0];
+		unsigned buffer { 0 };
+		unsigned long long i { 0 };
+		for(; i < array.length(); ++i){
+			buffer += sum[i] + array[i];
+			sum[i] = static_cast<unsigned char>(buffer);
+			buffer >>= 8;
+		}
+		for(; buffer; ++i){
+			buffer += sum[i];
+			sum[i] = static_cast<unsigned char>(buffer);
+			buffer >>= 8;
+		}
+	}
+	bool isNegative { compare(sums[0], sums[1]) < 0 };
+	tech::RuntimeArray<unsigned char> &result = sums[isNegative ? 1 : 0];
+	result -= sums[isNegative ? 0 : 1];
+	return Integer::fromMagnitude(result, isNegative);
+}
+
+Pointer<Integer> getIntegerSquareRoot(Pointer<Integer> number){
+	return getIntegerRoot(number, 2);
+}
+
+Pointer<Integer> getIntegerRoot(Pointer<Integer> number, unsigned long long degree){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(!degree) REPORT_ERROR(std::exception("Zero degree root exception"), nullptr);
+	if(number->isNegative()){
+		if(!(degree & 1)) REPORT_ERROR(std::exception("Even degree root of negative number exception"), nullptr);
+		Pointer<Integer> root = getRootOfMagnitude(staticPointerCast<Integer>(number->getNegation()), degree);
+		return staticPointerCast<Integer>(root->getNegation());
+	}
+	return getRootOfMagnitude(number, degree);
+}
+
+bool isPerfectSquare(Pointer<Integer> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), false);
+	if(number->isNegative()) return false;
+	static const std::vector<bool>
+		residues64 = getQuadraticResidues(64),
+		residues63 = getQuadraticResidues(63),
+		residues65 = getQuadraticResidues(65),
+		residues11 = getQuadraticResidues(11);
+	if(!residues64[number->getAsLongLong() & 63]) return false;
+	//63 * 65 * 11, so all three residues are taken from one remainder
+	unsigned long long remainder { number->getSmallRemainder(45045) };
+	if(!residues63[remainder % 63] || !residues65[remainder % 65] || !residues11[remainder % 11]) return false;
+	Pointer<Integer> root = getRootOfMagnitude(number, 2);
+	return staticPointerCast<Integer>(root->getProduct(root))->compare(number) == CompareResult::Equal;
+}
+
+bool isPerfectPower(Pointer<Integer> number){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), false);
+	Pointer<Integer> magnitude = staticPointerCast<Integer>(number->getAbsoluteValue());
+	unsigned long long bits { magnitude->getBitLength() };
+	if(bits <= 1) return true;
+	if(!number->isNegative() && isPerfectSquare(number)) return true;
+	//power of 2^k times odd number can only have exponent dividing k
+	unsigned long long trailingZeros { magnitude->getLowestSetBit() };
+	if(trailingZeros + 1 == bits){
+		if(!number->isNegative()) return trailingZeros > 1;
+		//negative powers need odd exponent
+		unsigned long long oddPart { trailingZeros };
+		while(!(oddPart & 1)) oddPart >>= 1;
+		return oddPart > 1;
+	}
+	for(unsigned long long exponent = 3; exponent < bits; exponent += 2){
+		bool isPrime { true };
+		for(unsigned long long divisor = 3; divisor * divisor <= exponent && isPrime; divisor += 2){
+			isPrime = exponent % divisor != 0;
+		}
+		if(!isPrime || (trailingZeros && trailingZeros % exponent)) continue;
+		Pointer<Integer> root = getRootOfMagnitude(magnitude, exponent);
+		if(getPower(root, exponent)->compare(magnitude) == CompareResult::Equal) return true;
+	}
+	return false;
+}
+
+std::vector<unsigned long long> getPrimes(unsigned long long limit){
+	std::vector<unsigned long long> primes;
+	if(limit < 2) return primes;
+	primes.push_back(2);
+	//only odd numbers are stored, index i represents 2i + 1
+	std::vector<bool> isComposite((limit + 1) / 2, false);
+	for(unsigned long long i = 1; i < isComposite.size(); ++i){
+		if(isComposite[i]) continue;
+		unsigned long long prime { 2 * i + 1 };
+		primes.push_back(prime);
+		for(unsigned long long j = prime * prime / 2; j < isComposite.size(); j += prime) isComposite[j] = true;
+	}
+	return primes;
+}
+
+Pointer<Integer> getFactorial(unsigned long long number){
+	std::vector<unsigned long long> primes = getPrimes(number);
+	if(!primes.empty()) primes.erase(primes.begin());
+	//exponent of two in n! is n minus number of set bits of n
+	unsigned long long twos { number };
+	for(unsigned long long rest = number; rest; rest >>= 1) twos -= rest & 1;
+	return getOddFactorial(number, primes)->getShiftedLeft(twos);
+}
+
+Pointer<Integer> getBinomial(unsigned long long n, unsigned long long k){
+	if(k > n) return Number::ZERO();
+	k = std::min(k, n - k);
+	if(n > SIEVE_LIMIT){
+		std::vector<unsigned long long> factors;
+		for(unsigned long long i = 0; i < k; ++i) factors.push_back(n - i);
+		return staticPointerCast<IntegerArithmetic<Pointer<Integer>>>(
+				getProductOfFactors(factors))->getIntegerQuotient(getFactorial(k));
+	}
+	std::vector<std::pair<unsigned long long, unsigned long long>> powers;
+	for(unsigned long long prime : getPrimes(n)){
+		unsigned long long exponent {
+			getFactorialExponent(n, prime) - getFactorialExponent(k, prime) - getFactorialExponent(n - k, prime) };
+		if(exponent) powers.emplace_back(prime, exponent);
+	}
+	return getProductOfPowers(powers);
+}
+
+Pointer<Integer> getMultinomial(const std::vector<unsigned long long> &counts){
+	unsigned long long sum { 0 };
+	for(unsigned long long count : counts){
+		if(sum > std::numeric_limits<unsigned long long>::max() - count){
+			REPORT_ERROR(std::exception("Overflow exception"), nullptr);
+		}
+		sum += count;
+	}
+	std::vector<std::pair<unsigned long long, unsigned long long>> powers;
+	for(unsigned long long prime : getPrimes(sum)){
+		unsigned long long exponent { getFactorialExponent(sum, prime) };
+		for(unsigned long long count : counts) exponent -= getFactorialExponent(count, prime);
+		if(exponent) powers.emplace_back(prime, exponent);
+	}
+	return getProductOfPowers(powers);
+}
+
+Pointer<Integer> getModularPower(Pointer<Integer> base, Pointer<Integer> exponent, Pointer<Integer> modulus){
+	if(!base || !exponent || !modulus) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	if(exponent->isNegative()) REPORT_ERROR(std::exception("Negative exponent exception"), nullptr);
+	if(modulus->isZero()) REPORT_ERROR(std::exception("Division by zero exception"), nullptr);
+	BarrettReducer reducer(staticPointerCast<Integer>(modulus->getAbsoluteValue()));
+	return getModularPower(reducer.getRemainder(base), getWords(exponent), reducer);
+}
+
+bool isProbablePrime(Pointer<Integer> number, unsigned rounds){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), false);
+	if(number->isNegative() || number->getBitLength() < 2) return false;
+	const std::vector<unsigned long long> &primes = getSmallPrimes();
+	if(number->getBitLength() <= 64){
+		unsigned long long value { static_cast<unsigned long long>(number->getAsLongLong()) };
+		if(value < SMALL_PRIME_LIMIT) return std::binary_search(primes.begin(), primes.end(), value);
+	}
+	std::vector<unsigned long long> remainders = getSmallPrimeRemainders(number);
+	if(std::find(remainders.begin(), remainders.end(), 0) != remainders.end()) return false;
+	return passesProbablePrimeTests(number, rounds);
+}
+
+Pointer<Integer> getNextPrime(Pointer<Integer> number, unsigned rounds){
+	if(!number) REPORT_ERROR(std::exception("Null pointer exception"), nullptr);
+	const std::vector<unsigned long long> &primes = getSmallPrimes();
+	if(number->isNegative() || number->getBitLength() < 2) return Unsigned::fromUnsignedLongLong(2);
+	if(number->getBitLength() <= 64){
+		unsigned long long value { static_cast<unsigned long long>(number->getAsLongLong()) };
+		auto prime = std::upper_bound(primes.begin(), primes.end(), value);
+		if(prime != primes.end()) return Unsigned::fromUnsignedLongLong(*prime);
+	}
+	//the least odd number greater than number
+	Pointer<Integer> start = staticPointerCast<Integer>(number->getSum(Number::ONE()));
+	if(!(start->getAsLongLong() & 1)) start = staticPointerCast<Integer>(start->getSum(Number::ONE()));
+	std::vector<unsigned long long> remainders = getSmallPrimeRemainders(start);
+	for(unsigned long long offset = 0;; offset += 2){
+		bool hasSmallFactor { false };
+		for(std::size_t i = 0; i < primes.size() && !hasSmallFactor; ++i){
+			hasSmallFactor = (remainders[i] + offset) % primes[i] == 0;
+		}
+		if(hasSmallFactor) continue;
+		Pointer<Integer> candidate = staticPointerCast<Integer>(start->getSum(Unsigned::fromUnsignedLongLong(offset)));
+		if(passesProbablePrimeTests(candidate, rounds)) return candidate;
+	}
+}
+
+}  // namespace numb
+}  // namespace coma
+
@@ -1,49 +1,303 @@
-/*
- * math.h
- *
- *  Created on: 28 lip 2015
- *      Author: Bartosz Miera
- */
-
-#ifndef NUMBERS_MATH_H_
-#define NUMBERS_MATH_H_
-
-#include "Integer.h"
-
-namespace coma {
-namespace numb {
-/**
- * @brief
- * 	Finds greatest common divisor of given Integers.
- *
- * @param numberOne
- * 	First number.
- *
- * @param numberTwo
- * 	Second number.
- *
- * @return
- * 	Greatest common divisor of @a numberOne and @a numberTwo.
- */
-Pointer<Integer> getGCD(Pointer<Integer> numberOne, Pointer<Integer> numberTwo);
-
-/**
- * @brief
- * 	Finds least common multiple of given Integers.
- *
- * @param numberOne
- * 	Fist number.
- *
- * @param numberTwo
- * 	Second number.
- *
- * @return
- * 	Least common multiple of @a numberOne and @a numberTwo.
- */
-Pointer<Integer> getLCM(Pointer<Integer> numberOne, Pointer<Integer> numberTwo);
-
-
-}  // namespace numb
-}  // namespace coma
-
-#endif /* NUMBERS_MATH_H_ */
+/*
+ * math.h
+ *
+ *  Created on: 28 lip 2015
+ *      Author: Bartosz Miera
+ */
+
+#ifndef NUMBERS_MATH_H_
+#define NUMBERS_MATH_H_
+
+#include "Integer.h"
+
+#include <vector>
+
+namespace coma {
+namespace numb {
+/**
+ * @brief
+ * 	Finds greatest common divisor of given Integers.
+ *
+ * @param numberOne
+ * 	First number.
+ *
+ * @param numberTwo
+ * 	Second number.
+ *
+ * @return
+ * 	Greatest common divisor of @a numberOne and @a numberTwo.
+ */
+Pointer<Integer> getGCD(Pointer<Integer> numberOne, Pointer<Integer> numberTwo);
+
+/**
+ * @brief
+ * 	Finds least common multiple of given Integers.
+ *
+ * @param numberOne
+ * 	Fist number.
+ *
+ * @param numberTwo
+ * 	Second number.
+ *
+ * @return
+ * 	Least common multiple of @a numberOne and @a numberTwo.
+ */
+Pointer<Integer> getLCM(Pointer<Integer> numberOne, Pointer<Integer> numberTwo);
+
+/**
+ * @brief
+ * 	Raises Integer to given power.
+ *
+ * @details
+ * 	Uses left-to-right sliding window exponentiation, so only squarings and one multiplication per window are
+ * 	performed. Powers of two are built directly without any multiplication.
+ *
+ * @param base
+ * 	Number to raise.
+ *
+ * @param exponent
+ * 	Power to which @a base is raised.
+ *
+ * @return
+ * 	@a base^@a exponent. For @a exponent equal 0 one is returned.
+ */
+Pointer<Integer> getPower(Pointer<Integer> base, unsigned long long exponent);
+
+/**
+ * @brief
+ * 	Multiplies all given Integers.
+ *
+ * @details
+ * 	Numbers are multiplied in balanced binary tree, so every multiplication has operands of similar size
+ * 	instead of one growing product multiplied by consecutive small factors. Subtrees of large enough products
+ * 	may be evaluated in separate threads.
+ *
+ * @param numbers
+ * 	Factors.
+ *
+ * @param parallel
+ * 	True if independent subtrees may be evaluated in parallel.
+ *
+ * @return
+ * 	Product of all @a numbers. For empty sequence one is returned.
+ */
+Pointer<Integer> getProductOf(const std::vector<Pointer<Integer>> &numbers, bool parallel = false);
+
+/**
+ * @brief
+ * 	Adds all given Integers.
+ *
+ * @details
+ * 	Absolute values of positive and negative numbers are accumulated in two buffers large enough for the result,
+ * 	so no partial sums are created.
+ *
+ * @param numbers
+ * 	Summands.
+ *
+ * @return
+ * 	Sum of all @a numbers. For empty sequence zero is returned.
+ */
+Pointer<Integer> getSumOf(const std::vector<Pointer<Integer>> &numbers);
+
+/**
+ * @brief
+ * 	Finds integer square root of given Integer.
+ *
+ * @details
+ * 	Equivalent to getIntegerRoot(@a number, 2).
+ *
+ * @param number
+ * 	Non-negative number.
+ *
+ * @return
+ * 	floor(sqrt(@a number)).
+ */
+Pointer<Integer> getIntegerSquareRoot(Pointer<Integer> number);
+
+/**
+ * @brief
+ * 	Finds integer root of given degree.
+ *
+ * @details
+ * 	Initial estimate is the root of the top bits of @a number found recursively, so it is correct on half of
+ * 	the result's bits and Newton iteration started from it needs only a few steps. Numbers of at most 64 bits
+ * 	are handled with built-in arithmetic.
+ *
+ * @param number
+ * 	Number to root, non-negative for even @a degree.
+ *
+ * @param degree
+ * 	Positive degree of root.
+ *
+ * @return
+ * 	Root of @a number rounded towards zero.
+ */
+Pointer<Integer> getIntegerRoot(Pointer<Integer> number, unsigned long long degree);
+
+/**
+ * @brief
+ * 	Checks if given Integer is a square of an Integer.
+ *
+ * @details
+ * 	Most of non-squares are rejected by quadratic residue tests modulo 64, 63, 65 and 11, which need no
+ * 	big number arithmetic. Square root is computed only for numbers passing all of them.
+ *
+ * @param number
+ * 	Number to check.
+ *
+ * @return
+ * 	True if @a number equals n^2 for some Integer n. Else returns false.
+ */
+bool isPerfectSquare(Pointer<Integer> number);
+
+/**
+ * @brief
+ * 	Checks if given Integer is a perfect power.
+ *
+ * @details
+ * 	Only prime exponents are tried, as any power is also a power with prime exponent. Exponents not dividing
+ * 	the number of trailing zero bits are skipped without computing roots.
+ *
+ * @param number
+ * 	Number to check.
+ *
+ * @return
+ * 	True if @a number equals n^k for some Integer n and k greater than 1. Else returns false.
+ */
+bool isPerfectPower(Pointer<Integer> number);
+
+/**
+ * @brief
+ * 	Finds all primes not greater than given limit.
+ *
+ * @details
+ * 	Uses sieve of Eratosthenes storing only odd numbers.
+ *
+ * @param limit
+ * 	Upper bound of primes.
+ *
+ * @return
+ * 	Increasing sequence of primes lesser than or equal to @a limit.
+ */
+std::vector<unsigned long long> getPrimes(unsigned long long limit);
+
+/**
+ * @brief
+ * 	Computes factorial of given number.
+ *
+ * @details
+ * 	Uses prime swing decomposition n! = (floor(n/2)!)^2 * swing(n), where prime factorization of swing(n) is
+ * 	read directly from sieve. Factors are multiplied in balanced product trees, so multiplications are done on
+ * 	numbers of similar size, and power of two is applied with a single shift.
+ *
+ * @param number
+ * 	Number which factorial is computed.
+ *
+ * @return
+ * 	@a number!.
+ */
+Pointer<Integer> getFactorial(unsigned long long number);
+
+/**
+ * @brief
+ * 	Computes binomial coefficient.
+ *
+ * @details
+ * 	Exponent of every prime is found with Legendre's formula, then prime powers are multiplied in balanced
+ * 	product trees. For very large @a n, for which sieving is too expensive, falling factorial divided by
+ * 	factorial of @a k is used instead.
+ *
+ * @param n
+ * 	Size of set.
+ *
+ * @param k
+ * 	Size of subset.
+ *
+ * @return
+ * 	Number of @a k element subsets of @a n element set. For @a k greater than @a n zero is returned.
+ */
+Pointer<Integer> getBinomial(unsigned long long n, unsigned long long k);
+
+/**
+ * @brief
+ * 	Computes multinomial coefficient.
+ *
+ * @details
+ * 	Computed from prime factorization like getBinomial().
+ *
+ * @param counts
+ * 	Sizes of parts, which sum must fit in unsigned long long.
+ *
+ * @return
+ * 	(k1 + ... + km)! / (k1! * ... * km!), where ki are elements of @a counts.
+ */
+Pointer<Integer> getMultinomial(const std::vector<unsigned long long> &counts);
+
+/**
+ * @brief
+ * 	Raises Integer to given power modulo given modulus.
+ *
+ * @details
+ * 	Every product is reduced with BarrettReducer, so only one long division is done for the reciprocal of
+ * 	@a modulus. Exponent is processed with sliding window and squares use squaring kernel.
+ *
+ * @param base
+ * 	Number to raise.
+ *
+ * @param exponent
+ * 	Non-negative exponent.
+ *
+ * @param modulus
+ * 	Non-zero modulus.
+ *
+ * @return
+ * 	@a base^@a exponent mod |@a modulus|, in range [0, |@a modulus|).
+ */
+Pointer<Integer> getModularPower(Pointer<Integer> base, Pointer<Integer> exponent, Pointer<Integer> modulus);
+
+/**
+ * @brief
+ * 	Checks if given Integer is probably prime.
+ *
+ * @details
+ * 	Performs trial division by small primes, then Baillie-PSW test: Miller-Rabin test with base 2 followed by
+ * 	strong Lucas test with Selfridge's parameters. No composite number passing Baillie-PSW test is known and
+ * 	there is none below 2^64. Additional Miller-Rabin tests with random bases may be requested, each of them
+ * 	lets through at most a quarter of composites.
+ *
+ * @param number
+ * 	Number to check.
+ *
+ * @param rounds
+ * 	Number of additional Miller-Rabin tests with random bases.
+ *
+ * @return
+ * 	True if @a number is probably prime. False if it is surely composite or lesser than 2.
+ */
+bool isProbablePrime(Pointer<Integer> number, unsigned rounds = 0);
+
+/**
+ * @brief
+ * 	Finds the least probable prime greater than given Integer.
+ *
+ * @details
+ * 	Remainders of the first candidate modulo small primes are computed once and updated for following
+ * 	candidates in built-in arithmetic, so most of candidates are rejected without any big number operation.
+ * 	Only the rest undergoes probable prime tests of isProbablePrime().
+ *
+ * @param number
+ * 	Any number.
+ *
+ * @param rounds
+ * 	Number of additional Miller-Rabin tests with random bases.
+ *
+ * @return
+ * 	The least probable prime greater than @a number.
+ */
+Pointer<Integer> getNextPrime(Pointer<Integer> number, unsigned rounds = 0);
+
+
+}  // namespace numb
+}  // namespace coma
+
+#endif /* NUMBERS_MATH_H_ */